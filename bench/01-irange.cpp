@@ -0,0 +1,69 @@
+// Copyright 2018-2022 Martin Moene
+//
+// https://github.com/martinmoene/type-lite
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Compare loops over raw int, over numeric<int> via operator++/<, and over irange<>.
+// Use -fopt-info-vec (GCC) or -Rpass=loop-vectorize (Clang) to see vectorized loops.
+
+#include "nonstd/type_irange.hpp"
+#include "bench.hpp"
+
+#include <vector>
+
+typedef nonstd::numeric<int, struct RowTag> RowIdx;
+
+const int N      = 4096;    // L1-resident
+const int repeat = 20000;
+
+// NOINLINE keeps each loop a separate vectorization unit:
+
+#if defined(__GNUC__) || defined(__clang__)
+# define bench_NOINLINE  __attribute__((noinline))
+#else
+# define bench_NOINLINE  __declspec(noinline)
+#endif
+
+bench_NOINLINE void saxpy_raw( float * y, float const * x, float a, int n )
+{
+    for ( int i = 0; i < n; ++i )
+        y[i] += a * x[i];
+}
+
+bench_NOINLINE void saxpy_numeric( float * y, float const * x, float a, RowIdx n )
+{
+    for ( RowIdx i(0); i < n; ++i )
+        y[ to_value(i) ] += a * x[ to_value(i) ];
+}
+
+bench_NOINLINE void saxpy_irange( float * y, float const * x, float a, RowIdx n )
+{
+    for ( RowIdx i : nonstd::irange<RowIdx>( n ) )
+        y[ to_value(i) ] += a * x[ to_value(i) ];
+}
+
+int main()
+{
+    std::vector<float> x( N, 1.0f );
+    std::vector<float> y( N, 0.0f );
+
+    double const t_raw = bench::measure_ns( [&]{
+        for ( int r = 0; r < repeat; ++r ) { saxpy_raw( y.data(), x.data(), 0.5f, N ); bench::do_not_optimize( y[0] ); } } );
+
+    double const t_num = bench::measure_ns( [&]{
+        for ( int r = 0; r < repeat; ++r ) { saxpy_numeric( y.data(), x.data(), 0.5f, RowIdx(N) ); bench::do_not_optimize( y[0] ); } } );
+
+    double const t_irn = bench::measure_ns( [&]{
+        for ( int r = 0; r < repeat; ++r ) { saxpy_irange( y.data(), x.data(), 0.5f, RowIdx(N) ); bench::do_not_optimize( y[0] ); } } );
+
+    std::size_t const n = std::size_t( N ) * repeat;
+
+    bench::report( "raw int loop"       , t_raw, n );
+    bench::report( "numeric<int> loop"  , t_num, n, t_raw );
+    bench::report( "irange<numeric<int>>", t_irn, n, t_raw );
+}
+
+// g++ -O2 -std=c++11 -I../include -o 01-irange 01-irange.cpp -fopt-info-vec
+// clang++ -O2 -std=c++11 -I../include -o 01-irange 01-irange.cpp -Rpass=loop-vectorize
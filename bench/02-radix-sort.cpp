@@ -0,0 +1,61 @@
+// Copyright 2018-2022 Martin Moene
+//
+// https://github.com/martinmoene/type-lite
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Compare std::sort via operator< of ordered<> with radix_sort(), sequential and parallel.
+// Usage: 02-radix-sort [count], default 10'000'000 elements.
+
+#include "nonstd/type_radix_sort.hpp"
+#include "bench.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+typedef nonstd::ordered <std::uint64_t, struct TimestampTag> Timestamp;
+typedef nonstd::numeric <std::int64_t , struct DeltaTag    > Delta;
+typedef nonstd::quantity<double       , struct EnergyTag   > Energy;
+
+template< typename S, typename Gen >
+void run( char const * name, std::size_t n, Gen gen )
+{
+    std::vector<S> input;
+    input.reserve( n );
+
+    for ( std::size_t i = 0; i != n; ++i )
+        input.push_back( S( gen() ) );
+
+    std::vector<S> v;
+
+    double const t_std = bench::measure_ns( [&]{
+        v = input; std::sort( v.begin(), v.end() ); bench::do_not_optimize( v[0] ); }, 3 );
+
+    double const t_rs1 = bench::measure_ns( [&]{
+        v = input; nonstd::radix_sort( v.begin(), v.end() ); bench::do_not_optimize( v[0] ); }, 3 );
+
+    double const t_rsn = bench::measure_ns( [&]{
+        v = input; nonstd::radix_sort( v.begin(), v.end(), 0 ); bench::do_not_optimize( v[0] ); }, 3 );
+
+    std::printf( "%s:\n", name );
+    bench::report( "  std::sort"              , t_std, n );
+    bench::report( "  radix_sort, 1 thread"   , t_rs1, n, t_std );
+    bench::report( "  radix_sort, all threads", t_rsn, n, t_std );
+}
+
+int main( int argc, char * argv[] )
+{
+    std::size_t const n = argc > 1 ? std::strtoul( argv[1], nullptr, 10 ) : 10000000u;
+
+    std::mt19937_64 gen( 42 );
+    std::uniform_real_distribution<double> dist( -1e9, 1e9 );
+
+    run<Timestamp>( "ordered<uint64_t>", n, [&]{ return gen(); } );
+    run<Delta    >( "numeric<int64_t>" , n, [&]{ return static_cast<std::int64_t>( gen() ); } );
+    run<Energy   >( "quantity<double>" , n, [&]{ return dist( gen ); } );
+}
+
+// g++ -O2 -std=c++11 -pthread -I../include -o 02-radix-sort 02-radix-sort.cpp
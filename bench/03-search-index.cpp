@@ -0,0 +1,66 @@
+// Copyright 2018-2022 Martin Moene
+//
+// https://github.com/martinmoene/type-lite
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Compare std::lower_bound() via operator< of ordered<> with search_index<>::lower_bound(),
+// for key arrays from L1-resident to DRAM-resident.
+// Usage: 03-search-index [max-log2-count], default 24 (16M keys, 128 MB).
+
+#include "nonstd/type_search_index.hpp"
+#include "bench.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+typedef nonstd::ordered<std::uint64_t, struct KeyTag> Key;
+typedef nonstd::search_index<Key> Index;
+
+int main( int argc, char * argv[] )
+{
+    int const max_log2 = argc > 1 ? std::atoi( argv[1] ) : 24;
+
+    std::size_t const queries = 1u << 20;
+
+    std::mt19937_64 gen( 42 );
+
+    std::printf( "%-12s %14s %14s %8s\n", "keys", "std ns/query", "index ns/query", "ratio" );
+
+    for ( int log2 = 10; log2 <= max_log2; log2 += 2 )
+    {
+        std::size_t const n = std::size_t(1) << log2;
+
+        std::vector<Key> keys;
+        keys.reserve( n );
+        for ( std::size_t i = 0; i != n; ++i )
+            keys.push_back( Key( gen() ) );
+        std::sort( keys.begin(), keys.end() );
+
+        std::vector<Key> probes;
+        probes.reserve( queries );
+        for ( std::size_t i = 0; i != queries; ++i )
+            probes.push_back( Key( gen() ) );
+
+        Index const index( keys.begin(), keys.end() );
+
+        double const t_std = bench::measure_ns( [&]{
+            std::size_t sum = 0;
+            for ( Key const & x : probes )
+                sum += static_cast<std::size_t>( std::lower_bound( keys.begin(), keys.end(), x ) - keys.begin() );
+            bench::do_not_optimize( sum ); }, 3 );
+
+        double const t_idx = bench::measure_ns( [&]{
+            std::size_t sum = 0;
+            for ( Key const & x : probes )
+                sum += to_value( index.lower_bound( x ) );
+            bench::do_not_optimize( sum ); }, 3 );
+
+        std::printf( "%-12zu %14.2f %14.2f %7.2fx\n", n, t_std / queries, t_idx / queries, t_idx / t_std );
+    }
+}
+
+// g++ -O2 -std=c++11 -I../include -o 03-search-index 03-search-index.cpp
@@ -0,0 +1,92 @@
+// Copyright 2018-2022 Martin Moene
+//
+// https://github.com/martinmoene/type-lite
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Compare a scan of one field of std::vector<struct> of strong types with
+// a scan of the same field of soa_vector<>, and a scan of all fields.
+// Usage: 04-soa-vector [max-log2-count], default 24 (16M records, 512 MB).
+
+#include "nonstd/type_soa_vector.hpp"
+#include "bench.hpp"
+
+#include <cstdint>
+#include <cstdlib>
+#include <vector>
+
+typedef nonstd::equality<std::uint64_t, struct OrderIdTag  > OrderId;
+typedef nonstd::quantity<std::int64_t , struct PriceTag    > Price;
+typedef nonstd::numeric <std::int64_t , struct QuantityTag > Quantity;
+typedef nonstd::ordered <std::uint64_t, struct TimestampTag> Timestamp;
+
+struct Order
+{
+    OrderId   id;
+    Price     price;
+    Quantity  quantity;
+    Timestamp time;
+};
+
+typedef nonstd::soa_vector<OrderId, Price, Quantity, Timestamp> Orders;
+
+int main( int argc, char * argv[] )
+{
+    int const max_log2 = argc > 1 ? std::atoi( argv[1] ) : 24;
+
+    std::printf( "%-12s %12s %12s %8s %12s %12s %8s\n", "records", "aos 1 field", "soa 1 field", "ratio", "aos all", "soa all", "ratio" );
+
+    for ( int log2 = 12; log2 <= max_log2; log2 += 2 )
+    {
+        std::size_t const n = std::size_t(1) << log2;
+
+        std::vector<Order> aos;
+        Orders soa;
+
+        aos.reserve( n );
+        soa.reserve( n );
+
+        for ( std::size_t i = 0; i != n; ++i )
+        {
+            std::int64_t const k = static_cast<std::int64_t>( i );
+
+            aos.push_back( Order{ OrderId( i ), Price( 100 + k % 7 ), Quantity( k % 13 ), Timestamp( 1000 + i ) } );
+            soa.push_back( OrderId( i ), Price( 100 + k % 7 ), Quantity( k % 13 ), Timestamp( 1000 + i ) );
+        }
+
+        double const t_aos1 = bench::measure_ns( [&]{
+            Quantity sum( 0 );
+            for ( Order const & o : aos )
+                sum += o.quantity;
+            bench::do_not_optimize( sum ); }, 5 );
+
+        double const t_soa1 = bench::measure_ns( [&]{
+            Quantity sum( 0 );
+            for ( Quantity const & q : soa.column<Quantity>() )
+                sum += q;
+            bench::do_not_optimize( sum ); }, 5 );
+
+        double const t_aos4 = bench::measure_ns( [&]{
+            std::int64_t sum = 0;
+            for ( Order const & o : aos )
+                sum += to_value( o.price ) * to_value( o.quantity ) + static_cast<std::int64_t>( to_value( o.time ) - to_value( o.id ) );
+            bench::do_not_optimize( sum ); }, 5 );
+
+        double const t_soa4 = bench::measure_ns( [&]{
+            std::int64_t sum = 0;
+            OrderId   const * id = soa.data<OrderId>();
+            Price     const * pr = soa.data<Price>();
+            Quantity  const * qu = soa.data<Quantity>();
+            Timestamp const * tm = soa.data<Timestamp>();
+            for ( std::size_t i = 0; i != n; ++i )
+                sum += to_value( pr[i] ) * to_value( qu[i] ) + static_cast<std::int64_t>( to_value( tm[i] ) - to_value( id[i] ) );
+            bench::do_not_optimize( sum ); }, 5 );
+
+        std::printf( "%-12zu %9.3f ns %9.3f ns %7.2fx %9.3f ns %9.3f ns %7.2fx\n", n,
+            t_aos1 / double(n), t_soa1 / double(n), t_soa1 / t_aos1,
+            t_aos4 / double(n), t_soa4 / double(n), t_soa4 / t_aos4 );
+    }
+}
+
+// g++ -O2 -std=c++11 -I../include -o 04-soa-vector 04-soa-vector.cpp
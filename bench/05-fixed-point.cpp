@@ -0,0 +1,128 @@
+// Copyright 2018-2022 Martin Moene
+//
+// https://github.com/martinmoene/type-lite
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Compare amount = price * quantity and average = amount / quantity with
+// double, with hand-rolled scaling of 64-bit integers in 1/10000 units and
+// with fixed_point<std::int64_t,16>, per rounding.
+// Usage: 05-fixed-point [count], default 1M.
+
+#include "nonstd/type_fixed_point.hpp"
+#include "bench.hpp"
+
+#include <cstdint>
+#include <cstdlib>
+#include <vector>
+
+template< typename Round >
+struct Money
+{
+    typedef nonstd::fixed_point<std::int64_t, 16, struct MoneyTag, Round> type;
+};
+
+// hand-rolled: values in 1/10000 units, product rescaled with rounding half away from zero:
+
+std::int64_t const scale = 10000;
+
+inline std::int64_t scaled_mul( std::int64_t a, std::int64_t b )
+{
+    std::int64_t const p = a * b;
+    return ( p + ( p >= 0 ? scale / 2 : -scale / 2 ) ) / scale;
+}
+
+inline std::int64_t scaled_div( std::int64_t a, std::int64_t b )
+{
+    std::int64_t const p = a * scale;
+    return ( p + ( ( p >= 0 ) == ( b >= 0 ) ? b / 2 : -b / 2 ) ) / b;
+}
+
+void report( char const * name, char const * op, double ns, std::size_t n, double baseline_ns = 0 )
+{
+    char label[64];
+    std::snprintf( label, sizeof label, "%s, %s", name, op );
+    bench::report( label, ns, n, baseline_ns );
+}
+
+template< typename Round >
+void run_fixed( char const * name, std::vector<double> const & price, std::vector<double> const & qty, double baseline_mul, double baseline_div )
+{
+    typedef typename Money<Round>::type M;
+
+    std::size_t const n = price.size();
+    std::vector<M> p, q;
+
+    for ( std::size_t i = 0; i != n; ++i )
+    {
+        p.push_back( M( price[i] ) );
+        q.push_back( M( qty[i] ) );
+    }
+
+    double const t_mul = bench::measure_ns( [&]{
+        M sum;
+        for ( std::size_t i = 0; i != n; ++i )
+            sum += p[i] * q[i];
+        bench::do_not_optimize( sum ); } );
+
+    double const t_div = bench::measure_ns( [&]{
+        M sum;
+        for ( std::size_t i = 0; i != n; ++i )
+            sum += p[i] / q[i];
+        bench::do_not_optimize( sum ); } );
+
+    report( name, "multiply", t_mul, n, baseline_mul );
+    report( name, "divide", t_div, n, baseline_div );
+}
+
+int main( int argc, char * argv[] )
+{
+    std::size_t const n = argc > 1 ? std::strtoul( argv[1], nullptr, 10 ) : 1000000u;
+
+    std::vector<double> price, qty;
+    std::vector<std::int64_t> price_i, qty_i;
+
+    for ( std::size_t i = 0; i != n; ++i )
+    {
+        price.push_back( 1.0 + double( i % 9973 ) / 100.0 );
+        qty  .push_back( 0.5 + double( i % 101 ) );
+        price_i.push_back( static_cast<std::int64_t>( price.back() * scale + 0.5 ) );
+        qty_i  .push_back( static_cast<std::int64_t>( qty  .back() * scale + 0.5 ) );
+    }
+
+    double const t_double_mul = bench::measure_ns( [&]{
+        double sum = 0;
+        for ( std::size_t i = 0; i != n; ++i )
+            sum += price[i] * qty[i];
+        bench::do_not_optimize( sum ); } );
+
+    double const t_double_div = bench::measure_ns( [&]{
+        double sum = 0;
+        for ( std::size_t i = 0; i != n; ++i )
+            sum += price[i] / qty[i];
+        bench::do_not_optimize( sum ); } );
+
+    double const t_scaled_mul = bench::measure_ns( [&]{
+        std::int64_t sum = 0;
+        for ( std::size_t i = 0; i != n; ++i )
+            sum += scaled_mul( price_i[i], qty_i[i] );
+        bench::do_not_optimize( sum ); } );
+
+    double const t_scaled_div = bench::measure_ns( [&]{
+        std::int64_t sum = 0;
+        for ( std::size_t i = 0; i != n; ++i )
+            sum += scaled_div( price_i[i], qty_i[i] );
+        bench::do_not_optimize( sum ); } );
+
+    report( "double", "multiply", t_double_mul, n );
+    report( "double", "divide", t_double_div, n );
+    report( "int64_t, 1/10000", "multiply", t_scaled_mul, n, t_double_mul );
+    report( "int64_t, 1/10000", "divide", t_scaled_div, n, t_double_div );
+
+    run_fixed< nonstd::round_nearest_t     >( "fixed_point, nearest",      price, qty, t_double_mul, t_double_div );
+    run_fixed< nonstd::round_toward_zero_t >( "fixed_point, toward zero",  price, qty, t_double_mul, t_double_div );
+    run_fixed< nonstd::round_down_t        >( "fixed_point, down",         price, qty, t_double_mul, t_double_div );
+}
+
+// g++ -O2 -std=c++11 -I../include -o 05-fixed-point 05-fixed-point.cpp
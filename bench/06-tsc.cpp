@@ -0,0 +1,52 @@
+// Copyright 2018-2022 Martin Moene
+//
+// https://github.com/martinmoene/type-lite
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Compare the cost of reading the time-stamp counter via tsc_now() with
+// std::chrono::steady_clock::now() and std::chrono::high_resolution_clock::now().
+// Usage: 06-tsc [count], default 10M.
+
+#include "nonstd/type_tsc.hpp"
+#include "bench.hpp"
+
+#include <cstdlib>
+
+int main( int argc, char * argv[] )
+{
+    std::size_t const n = argc > 1 ? std::strtoul( argv[1], nullptr, 10 ) : 10000000u;
+
+    std::printf( "counter: %s, %.3f ticks/ns\n\n", type_CONFIG_TSC_COUNTER ? "cpu" : "steady_clock", nonstd::tsc_ticks_per_ns() );
+
+    double const t_steady = bench::measure_ns( [&]{
+        std::chrono::steady_clock::time_point t;
+        for ( std::size_t i = 0; i != n; ++i )
+        {
+            t = std::chrono::steady_clock::now();
+            bench::do_not_optimize( t );
+        } } );
+
+    double const t_hires = bench::measure_ns( [&]{
+        std::chrono::high_resolution_clock::time_point t;
+        for ( std::size_t i = 0; i != n; ++i )
+        {
+            t = std::chrono::high_resolution_clock::now();
+            bench::do_not_optimize( t );
+        } } );
+
+    double const t_tsc = bench::measure_ns( [&]{
+        nonstd::tsc_point t;
+        for ( std::size_t i = 0; i != n; ++i )
+        {
+            t = nonstd::tsc_now();
+            bench::do_not_optimize( t );
+        } } );
+
+    bench::report( "steady_clock::now()"         , t_steady, n );
+    bench::report( "high_resolution_clock::now()", t_hires , n, t_steady );
+    bench::report( "tsc_now()"                   , t_tsc   , n, t_steady );
+}
+
+// g++ -O2 -std=c++11 -I../include -o 06-tsc 06-tsc.cpp
@@ -0,0 +1,79 @@
+// Copyright 2018-2022 Martin Moene
+//
+// https://github.com/martinmoene/type-lite
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Compare memory use and the speed of a scan that sums the present values
+// of an array of compact_optional<Id> and of std::optional<Id> (C++17).
+// Usage: 07-compact-optional [max-log2-count], default 24 (16M elements).
+
+#include "nonstd/type_compact_optional.hpp"
+#include "bench.hpp"
+
+#include <cstdint>
+#include <cstdlib>
+#include <vector>
+
+#if type_CPP17_OR_GREATER
+
+#include <optional>
+
+typedef nonstd::numeric<std::int64_t, struct IdTag, nonstd::custom_default_t<std::int64_t, -1> > Id;
+
+int main( int argc, char * argv[] )
+{
+    int const max_log2 = argc > 1 ? std::atoi( argv[1] ) : 24;
+
+    std::printf( "element size: compact_optional<Id> %zu bytes, std::optional<Id> %zu bytes\n\n",
+        sizeof( nonstd::compact_optional<Id> ), sizeof( std::optional<Id> ) );
+
+    std::printf( "%-12s %14s %14s %8s\n", "elements", "compact", "std::optional", "ratio" );
+
+    for ( int log2 = 12; log2 <= max_log2; log2 += 2 )
+    {
+        std::size_t const n = std::size_t(1) << log2;
+
+        std::vector< nonstd::compact_optional<Id> > compact( n );
+        std::vector< std::optional<Id> > standard( n );
+
+        // every third element empty:
+
+        for ( std::size_t i = 0; i != n; ++i )
+        {
+            if ( i % 3 != 0 )
+            {
+                compact [i] = Id( static_cast<std::int64_t>( i ) );
+                standard[i] = Id( static_cast<std::int64_t>( i ) );
+            }
+        }
+
+        double const t_compact = bench::measure_ns( [&]{
+            Id sum( 0 );
+            for ( auto const & o : compact )
+                if ( o )
+                    sum += *o;
+            bench::do_not_optimize( sum ); }, 5 );
+
+        double const t_standard = bench::measure_ns( [&]{
+            Id sum( 0 );
+            for ( auto const & o : standard )
+                if ( o )
+                    sum += *o;
+            bench::do_not_optimize( sum ); }, 5 );
+
+        std::printf( "%-12zu %11.3f ns %11.3f ns %7.2fx\n", n, t_compact / double(n), t_standard / double(n), t_standard / t_compact );
+    }
+}
+
+#else
+
+int main()
+{
+    std::printf( "07-compact-optional: requires C++17 for std::optional\n" );
+}
+
+#endif // type_CPP17_OR_GREATER
+
+// g++ -O2 -std=c++17 -I../include -o 07-compact-optional 07-compact-optional.cpp
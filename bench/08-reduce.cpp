@@ -0,0 +1,82 @@
+// Copyright 2018-2022 Martin Moene
+//
+// https://github.com/martinmoene/type-lite
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Compare std::accumulate() and std::minmax_element() over strong values with
+// nonstd::strong_sum(), strong_sum_compensated() and strong_minmax(), on one
+// and on all threads.
+// Usage: 08-reduce [count], default 16M.
+
+#include "nonstd/type_reduce.hpp"
+#include "bench.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <numeric>
+#include <vector>
+
+typedef nonstd::quantity<double      , struct EnergyTag> Energy;
+typedef nonstd::numeric <std::int64_t, struct CountTag > Count;
+
+int main( int argc, char * argv[] )
+{
+    std::size_t const n = argc > 1 ? std::strtoul( argv[1], nullptr, 10 ) : 16u << 20;
+
+    std::vector<Energy> energy;
+    std::vector<Count>  count;
+
+    for ( std::size_t i = 0; i != n; ++i )
+    {
+        energy.push_back( Energy( 0.5 + double( i % 1013 ) ) );
+        count .push_back( Count( static_cast<std::int64_t>( ( i * 7919 ) % 100003 ) ) );
+    }
+
+    std::printf( "%zu elements, %u hardware threads\n\n", n, std::thread::hardware_concurrency() );
+
+    double const t_acc_e = bench::measure_ns( [&]{
+        bench::do_not_optimize( std::accumulate( energy.begin(), energy.end(), Energy( 0.0 ) ) ); } );
+
+    double const t_sum_e = bench::measure_ns( [&]{
+        bench::do_not_optimize( nonstd::strong_sum( energy.begin(), energy.end() ) ); } );
+
+    double const t_sum_e_par = bench::measure_ns( [&]{
+        bench::do_not_optimize( nonstd::strong_sum( energy.begin(), energy.end(), 0 ) ); } );
+
+    double const t_kahan_e = bench::measure_ns( [&]{
+        bench::do_not_optimize( nonstd::strong_sum_compensated( energy.begin(), energy.end() ) ); } );
+
+    double const t_kahan_e_par = bench::measure_ns( [&]{
+        bench::do_not_optimize( nonstd::strong_sum_compensated( energy.begin(), energy.end(), 0 ) ); } );
+
+    double const t_acc_c = bench::measure_ns( [&]{
+        bench::do_not_optimize( std::accumulate( count.begin(), count.end(), Count( 0 ) ) ); } );
+
+    double const t_sum_c = bench::measure_ns( [&]{
+        bench::do_not_optimize( nonstd::strong_sum( count.begin(), count.end() ) ); } );
+
+    double const t_mm_std = bench::measure_ns( [&]{
+        bench::do_not_optimize( *std::minmax_element( count.begin(), count.end() ).first ); } );
+
+    double const t_mm = bench::measure_ns( [&]{
+        bench::do_not_optimize( nonstd::strong_minmax( count.begin(), count.end() ).first ); } );
+
+    double const t_mm_par = bench::measure_ns( [&]{
+        bench::do_not_optimize( nonstd::strong_minmax( count.begin(), count.end(), 0 ).first ); } );
+
+    bench::report( "double: std::accumulate()"           , t_acc_e      , n );
+    bench::report( "double: strong_sum()"                , t_sum_e      , n, t_acc_e );
+    bench::report( "double: strong_sum(), all threads"   , t_sum_e_par  , n, t_acc_e );
+    bench::report( "double: strong_sum_compensated()"    , t_kahan_e    , n, t_acc_e );
+    bench::report( "double: strong_sum_comp., all thr."  , t_kahan_e_par, n, t_acc_e );
+    bench::report( "int64: std::accumulate()"            , t_acc_c      , n );
+    bench::report( "int64: strong_sum()"                 , t_sum_c      , n, t_acc_c );
+    bench::report( "int64: std::minmax_element()"        , t_mm_std     , n );
+    bench::report( "int64: strong_minmax()"              , t_mm         , n, t_mm_std );
+    bench::report( "int64: strong_minmax(), all threads" , t_mm_par     , n, t_mm_std );
+}
+
+// g++ -O2 -std=c++11 -I../include -o 08-reduce 08-reduce.cpp -pthread
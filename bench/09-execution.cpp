@@ -0,0 +1,127 @@
+// Copyright 2018-2022 Martin Moene
+//
+// https://github.com/martinmoene/type-lite
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Compare the standard parallel algorithms std::transform(), std::reduce()
+// and std::sort() over strong values of each family with the same algorithms
+// over their underlying values (C++17).
+// Usage: 09-execution [count], default 16M.
+
+#include "nonstd/type.hpp"
+#include "bench.hpp"
+
+#if type_CPP17_OR_GREATER && defined( __has_include )
+# if __has_include( <execution> )
+#  include <execution>
+# endif
+#endif
+
+#include <cstdint>
+#include <cstdlib>
+#include <thread>
+#include <vector>
+
+#if defined( __cpp_lib_execution )
+
+#include <algorithm>
+#include <numeric>
+
+typedef nonstd::bits    < std::uint32_t, struct MaskTag   > Mask;
+typedef nonstd::ordered < std::int64_t , struct RankTag   > Rank;
+typedef nonstd::numeric < std::int64_t , struct CountTag  > Count;
+typedef nonstd::quantity< double       , struct EnergyTag > Energy;
+typedef nonstd::offset  < std::int64_t , struct PosTag    > Offset;
+typedef nonstd::address < std::int64_t , std::int64_t, PosTag > Address;
+
+template< typename T >
+T value_of( std::size_t i )
+{
+    return static_cast<T>( ( i * 7919u ) % 100003u );
+}
+
+template< typename S, typename T >
+std::vector<S> values( std::size_t n )
+{
+    std::vector<S> v;
+    v.reserve( n );
+    for ( std::size_t i = 0; i != n; ++i )
+        v.push_back( S( value_of<T>( i ) ) );
+    return v;
+}
+
+// time op over the underlying values and over the strong values, report both:
+
+template< typename T, typename S, typename Op, typename SOp >
+void compare( char const * name, std::size_t n, Op op, SOp sop )
+{
+    std::vector<T> raw    = values<T, T>( n );
+    std::vector<S> strong = values<S, T>( n );
+
+    double const t_raw    = bench::measure_ns( [&]{ op ( raw    ); } );
+    double const t_strong = bench::measure_ns( [&]{ sop( strong ); } );
+
+    std::printf( "%s\n", name );
+    bench::report( "  underlying", t_raw   , n );
+    bench::report( "  strong"    , t_strong, n, t_raw );
+}
+
+int main( int argc, char * argv[] )
+{
+    using namespace std::execution;
+
+    std::size_t const n = argc > 1 ? std::strtoul( argv[1], nullptr, 10 ) : 16u << 20;
+
+    std::printf( "%zu elements, %u hardware threads\n\n", n, std::thread::hardware_concurrency() );
+
+    compare< std::int64_t, Count >( "numeric: transform(par_unseq, 3 * x - x)", n,
+        []( std::vector<std::int64_t> & v ) { std::transform( par_unseq, v.begin(), v.end(), v.begin(), []( std::int64_t x ) { return 3 * x - x; } ); bench::do_not_optimize( v.back() ); },
+        []( std::vector<Count>        & v ) { std::transform( par_unseq, v.begin(), v.end(), v.begin(), []( Count const & x ) { return Count( 3 ) * x - x; } ); bench::do_not_optimize( v.back() ); } );
+
+    compare< double, Energy >( "quantity: transform(par_unseq, 2 * x - x / 4)", n,
+        []( std::vector<double> & v ) { std::transform( par_unseq, v.begin(), v.end(), v.begin(), []( double x ) { return 2.0 * x - x / 4.0; } ); bench::do_not_optimize( v.back() ); },
+        []( std::vector<Energy> & v ) { std::transform( par_unseq, v.begin(), v.end(), v.begin(), []( Energy const & x ) { return 2.0 * x - x / 4.0; } ); bench::do_not_optimize( v.back() ); } );
+
+    compare< std::uint32_t, Mask >( "bits: transform(par_unseq, ~x ^ (x << 3))", n,
+        []( std::vector<std::uint32_t> & v ) { std::transform( par_unseq, v.begin(), v.end(), v.begin(), []( std::uint32_t x ) { return ~x ^ ( x << 3 ); } ); bench::do_not_optimize( v.back() ); },
+        []( std::vector<Mask>          & v ) { std::transform( par_unseq, v.begin(), v.end(), v.begin(), []( Mask const & x ) { return ~x ^ ( x << 3 ); } ); bench::do_not_optimize( v.back() ); } );
+
+    compare< std::int64_t, Address >( "address: transform(par_unseq, x + offset)", n,
+        []( std::vector<std::int64_t> & v ) { std::transform( par_unseq, v.begin(), v.end(), v.begin(), []( std::int64_t x ) { return x + 64; } ); bench::do_not_optimize( v.back() ); },
+        []( std::vector<Address>      & v ) { std::transform( par_unseq, v.begin(), v.end(), v.begin(), []( Address const & x ) { return x + Offset( 64 ); } ); bench::do_not_optimize( v.back() ); } );
+
+    compare< std::int64_t, Count >( "numeric: reduce(par_unseq)", n,
+        []( std::vector<std::int64_t> & v ) { bench::do_not_optimize( std::reduce( par_unseq, v.begin(), v.end(), std::int64_t( 0 ) ) ); },
+        []( std::vector<Count>        & v ) { bench::do_not_optimize( std::reduce( par_unseq, v.begin(), v.end(), Count( 0 ) ) ); } );
+
+    compare< double, Energy >( "quantity: reduce(par_unseq)", n,
+        []( std::vector<double> & v ) { bench::do_not_optimize( std::reduce( par_unseq, v.begin(), v.end(), 0.0 ) ); },
+        []( std::vector<Energy> & v ) { bench::do_not_optimize( std::reduce( par_unseq, v.begin(), v.end(), Energy( 0.0 ) ) ); } );
+
+    // sort a fresh copy each time; the copy is part of both timings:
+
+    std::vector<std::int64_t> const raw     = values<std::int64_t, std::int64_t>( n );
+    std::vector<Rank>         const ranks   = values<Rank, std::int64_t>( n );
+    std::vector<Offset>       const offsets = values<Offset, std::int64_t>( n );
+
+    compare< std::int64_t, Rank >( "ordered: sort(par)", n,
+        [&]( std::vector<std::int64_t> & v ) { v = raw; std::sort( par, v.begin(), v.end() ); bench::do_not_optimize( v.back() ); },
+        [&]( std::vector<Rank>         & v ) { v = ranks; std::sort( par, v.begin(), v.end() ); bench::do_not_optimize( v.back() ); } );
+
+    compare< std::int64_t, Offset >( "offset: sort(par)", n,
+        [&]( std::vector<std::int64_t> & v ) { v = raw; std::sort( par, v.begin(), v.end() ); bench::do_not_optimize( v.back() ); },
+        [&]( std::vector<Offset>       & v ) { v = offsets; std::sort( par, v.begin(), v.end() ); bench::do_not_optimize( v.back() ); } );
+}
+
+#else // __cpp_lib_execution
+
+int main()
+{
+    std::printf( "09-execution: the standard parallel algorithms are not available (C++17 <execution>)\n" );
+}
+
+#endif // __cpp_lib_execution
+
+// g++ -O2 -std=c++17 -I../include -o 09-execution 09-execution.cpp -ltbb -pthread
@@ -0,0 +1,141 @@
+// Copyright 2018-2022 Martin Moene
+//
+// https://github.com/martinmoene/type-lite
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Compare std::sort() and std::map<> lookup of keys with a defaulted operator<=>()
+// whose first member is an ordered strong type with operator<=>() (C++20) and
+// one with only operator<() and operator==(), for std::string and std::int64_t.
+// Without operator<=>(), the defaulted comparison of the key synthesizes it
+// from two calls of operator<(). Usage: 10-three-way [count], default 1M.
+
+#include "nonstd/type.hpp"
+#include "bench.hpp"
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+
+#if type_HAVE_THREE_WAY_COMPARISON
+
+#include <algorithm>
+#include <compare>
+#include <map>
+#include <string>
+#include <vector>
+
+// ordered, as without operator<=>():
+
+template< typename T >
+struct ordered_lt : nonstd::type<T, struct LegacyTag>
+{
+    ordered_lt() = default;
+    explicit ordered_lt( T v ) : nonstd::type<T, struct LegacyTag>( std::move( v ) ) {}
+
+    friend bool operator==( ordered_lt const & x, ordered_lt const & y ) { return x.get() == y.get(); }
+    friend bool operator< ( ordered_lt const & x, ordered_lt const & y ) { return x.get() <  y.get(); }
+};
+
+template< typename S >
+struct Key
+{
+    S   name;
+    int version;
+
+    std::weak_ordering operator<=>( Key const & ) const = default;
+    bool operator==( Key const & ) const = default;
+};
+
+// values that share a long prefix, respectively large integers:
+
+inline std::string make_value( std::size_t i, std::string const * )
+{
+    return std::string( "/usr/local/share/type-lite/resources/" ) + std::to_string( ( i * 7919 ) % 1000003 );
+}
+
+inline std::int64_t make_value( std::size_t i, std::int64_t const * )
+{
+    return static_cast<std::int64_t>( ( i * 7919 ) % 1000003 );
+}
+
+template< typename S >
+std::vector< Key<S> > make_keys( std::size_t n )
+{
+    typedef typename S::underlying_type T;
+
+    std::vector< Key<S> > v;
+    v.reserve( n );
+    for ( std::size_t i = 0; i != n; ++i )
+        v.push_back( Key<S>{ S( make_value( i / 4, static_cast<T const *>( nullptr ) ) ), static_cast<int>( i % 4 ) } );
+    return v;
+}
+
+template< typename S >
+double time_sort( std::size_t n )
+{
+    std::vector< Key<S> > const keys = make_keys<S>( n );
+
+    return bench::measure_ns( [&]{
+        std::vector< Key<S> > v = keys;
+        std::sort( v.begin(), v.end() );
+        bench::do_not_optimize( v.front() );
+    }, 3 );
+}
+
+template< typename S >
+double time_map( std::size_t n )
+{
+    std::vector< Key<S> > const keys = make_keys<S>( n );
+
+    std::map< Key<S>, int > m;
+    for ( Key<S> const & k : keys )
+        m.emplace( k, k.version );
+
+    return bench::measure_ns( [&]{
+        long found = 0;
+        for ( Key<S> const & k : keys )
+            found += m.find( k )->second;
+        bench::do_not_optimize( found );
+    }, 3 );
+}
+
+template< typename T >
+void compare( char const * name, std::size_t n )
+{
+    typedef ordered_lt     < T                  > Legacy;
+    typedef nonstd::ordered< T, struct ThreeTag > Ordered;
+
+    double const t_sort_lt  = time_sort< Legacy  >( n );
+    double const t_sort_cmp = time_sort< Ordered >( n );
+    double const t_map_lt   = time_map < Legacy  >( n );
+    double const t_map_cmp  = time_map < Ordered >( n );
+
+    std::printf( "%s\n", name );
+    bench::report( "  sort, operator<() only"   , t_sort_lt , n );
+    bench::report( "  sort, operator<=>()"      , t_sort_cmp, n, t_sort_lt );
+    bench::report( "  map::find, operator<() only", t_map_lt  , n );
+    bench::report( "  map::find, operator<=>()" , t_map_cmp , n, t_map_lt );
+}
+
+int main( int argc, char * argv[] )
+{
+    std::size_t const n = argc > 1 ? std::strtoul( argv[1], nullptr, 10 ) : 1u << 20;
+
+    std::printf( "%zu keys\n\n", n );
+
+    compare< std::string  >( "std::string", n );
+    compare< std::int64_t >( "std::int64_t", n );
+}
+
+#else // type_HAVE_THREE_WAY_COMPARISON
+
+int main()
+{
+    std::printf( "10-three-way: operator<=>() is not available (C++20)\n" );
+}
+
+#endif // type_HAVE_THREE_WAY_COMPARISON
+
+// g++ -O2 -std=c++20 -I../include -o 10-three-way 10-three-way.cpp
@@ -0,0 +1,102 @@
+// Copyright 2018-2022 Martin Moene
+//
+// https://github.com/martinmoene/type-lite
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Compare lookup of parsed std::string_view names in std::unordered_map<> and
+// std::map<> with strong std::string keys, by constructing an owning key per
+// lookup and by heterogeneous lookup with a strong std::string_view (C++20).
+// Usage: 11-transparent-lookup [count], default 1M.
+
+#include "nonstd/type_transparent.hpp"
+#include "bench.hpp"
+
+#include <cstdio>
+#include <cstdlib>
+
+#if type_CPP17_OR_GREATER && defined( __cpp_lib_generic_unordered_lookup )
+
+#include <map>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+typedef nonstd::ordered< std::string, struct UserTag > User;
+typedef nonstd::strong_view< User >::type              UserView;
+
+typedef std::unordered_map< User, int, nonstd::transparent_hash<User>, nonstd::transparent_equal_to<User> > UserHashMap;
+typedef std::map          < User, int, nonstd::transparent_less<User> > UserMap;
+
+int main( int argc, char * argv[] )
+{
+    std::size_t const n = argc > 1 ? std::strtoul( argv[1], nullptr, 10 ) : 1u << 20;
+
+    // names beyond the small-string buffer, as views into one parsed buffer:
+
+    std::size_t const users = 10000;
+
+    std::string buffer;
+    for ( std::size_t i = 0; i != users; ++i )
+        buffer += "user-" + std::to_string( 100000000 + i ) + "@example.org;";
+
+    std::vector<std::string_view> names;
+    for ( std::size_t pos = 0; pos < buffer.size(); )
+    {
+        std::size_t const end = buffer.find( ';', pos );
+        names.push_back( std::string_view( buffer ).substr( pos, end - pos ) );
+        pos = end + 1;
+    }
+
+    UserHashMap hashed;
+    UserMap     ordered;
+    for ( std::size_t i = 0; i != users; ++i )
+    {
+        hashed .emplace( User( std::string( names[i] ) ), int( i ) );
+        ordered.emplace( User( std::string( names[i] ) ), int( i ) );
+    }
+
+    double const t_hash_owning = bench::measure_ns( [&]{
+        long sum = 0;
+        for ( std::size_t i = 0; i != n; ++i )
+            sum += hashed.find( User( std::string( names[ i % users ] ) ) )->second;
+        bench::do_not_optimize( sum ); } );
+
+    double const t_hash_view = bench::measure_ns( [&]{
+        long sum = 0;
+        for ( std::size_t i = 0; i != n; ++i )
+            sum += hashed.find( UserView( names[ i % users ] ) )->second;
+        bench::do_not_optimize( sum ); } );
+
+    double const t_map_owning = bench::measure_ns( [&]{
+        long sum = 0;
+        for ( std::size_t i = 0; i != n; ++i )
+            sum += ordered.find( User( std::string( names[ i % users ] ) ) )->second;
+        bench::do_not_optimize( sum ); } );
+
+    double const t_map_view = bench::measure_ns( [&]{
+        long sum = 0;
+        for ( std::size_t i = 0; i != n; ++i )
+            sum += ordered.find( UserView( names[ i % users ] ) )->second;
+        bench::do_not_optimize( sum ); } );
+
+    std::printf( "%zu lookups of %zu users\n\n", n, users );
+
+    bench::report( "unordered_map: owning key"   , t_hash_owning, n );
+    bench::report( "unordered_map: strong view"  , t_hash_view  , n, t_hash_owning );
+    bench::report( "map: owning key"             , t_map_owning , n );
+    bench::report( "map: strong view"            , t_map_view   , n, t_map_owning );
+}
+
+#else
+
+int main()
+{
+    std::printf( "11-transparent-lookup: heterogeneous lookup in unordered containers is not available (C++20)\n" );
+}
+
+#endif
+
+// g++ -O2 -std=c++20 -I../include -o 11-transparent-lookup 11-transparent-lookup.cpp
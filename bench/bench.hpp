@@ -0,0 +1,69 @@
+// Copyright 2018-2022 Martin Moene
+//
+// https://github.com/martinmoene/type-lite
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Minimal timing support for the type-lite benchmarks (C++11).
+
+#ifndef BENCH_TYPE_HPP_INCLUDED
+#define BENCH_TYPE_HPP_INCLUDED
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+
+namespace bench {
+
+// prevent the optimizer from discarding a computed value:
+
+template< typename T >
+inline void do_not_optimize( T const & value )
+{
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile( "" : : "r,m"( value ) : "memory" );
+#else
+    static volatile char sink;
+    sink = *reinterpret_cast<char const volatile *>( &value );
+#endif
+}
+
+// best-of-repeat wall time of f() in nanoseconds, after a warm-up run:
+
+template< typename F >
+inline double measure_ns( F f, int repeat = 7 )
+{
+    typedef std::chrono::steady_clock clock;
+
+    double best = 1e300;
+
+    f();    // warm-up
+
+    for ( int i = 0; i < repeat; ++i )
+    {
+        clock::time_point const start = clock::now();
+        f();
+        clock::time_point const stop  = clock::now();
+
+        best = (std::min)( best, std::chrono::duration<double, std::nano>( stop - start ).count() );
+    }
+    return best;
+}
+
+// report time per element and relative to a baseline:
+
+inline void report( char const * name, double ns, std::size_t n, double baseline_ns = 0 )
+{
+    if ( baseline_ns > 0 )
+        std::printf( "%-36s %10.3f ns/elem  %6.2fx\n", name, ns / double(n), ns / baseline_ns );
+    else
+        std::printf( "%-36s %10.3f ns/elem\n", name, ns / double(n) );
+}
+
+} // namespace bench
+
+#endif // BENCH_TYPE_HPP_INCLUDED
+
+// end of file
@@ -0,0 +1,51 @@
+# Copyright 2022 by Martin Moene
+#
+# https://github.com/martinmoene/type-lite
+#
+# Distributed under the Boost Software License, Version 1.0.
+# (See accompanying file LICENSE.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+# C++20 named module nonstd.type, built from include/nonstd/type.cppm.
+#
+# Provides target ${package_name}-module; link it and 'import nonstd.type;'.
+# Uses CMake's module support where available (CMake 3.28 and later with
+# Ninja or Visual Studio), otherwise GCC 11 and later with a module mapper
+# that maps the module name to a fixed compiled-module-interface file.
+
+set( module_name   "nonstd.type" )
+set( module_target "${package_name}-module" )
+set( module_source "${CMAKE_CURRENT_SOURCE_DIR}/include/nonstd/type.cppm" )
+
+if ( NOT CMAKE_VERSION VERSION_LESS 3.28 AND CMAKE_GENERATOR MATCHES "Ninja|Visual Studio" )
+    message( STATUS "Module '${module_name}': CMake module support" )
+
+    add_library            ( ${module_target} STATIC )
+    target_sources         ( ${module_target} PUBLIC FILE_SET CXX_MODULES BASE_DIRS include/nonstd FILES ${module_source} )
+    target_compile_features( ${module_target} PUBLIC cxx_std_20 )
+    target_link_libraries  ( ${module_target} PUBLIC ${package_name} )
+
+elseif ( CMAKE_CXX_COMPILER_ID MATCHES "GNU" AND NOT CMAKE_CXX_COMPILER_VERSION VERSION_LESS 11 )
+    message( STATUS "Module '${module_name}': GCC module mapper" )
+
+    set( module_cmi    "${CMAKE_CURRENT_BINARY_DIR}/gcm.cache/${module_name}.gcm" )
+    set( module_mapper "${CMAKE_CURRENT_BINARY_DIR}/${module_name}.map" )
+
+    file( MAKE_DIRECTORY "${CMAKE_CURRENT_BINARY_DIR}/gcm.cache" )
+    file( WRITE "${module_mapper}" "${module_name} ${module_cmi}\n" )
+
+    set_source_files_properties( ${module_source} PROPERTIES LANGUAGE CXX COMPILE_OPTIONS "-xc++" OBJECT_OUTPUTS "${module_cmi}" )
+
+    add_library            ( ${module_target} STATIC ${module_source} )
+    target_compile_features( ${module_target} PUBLIC cxx_std_20 )
+    target_compile_options ( ${module_target} PUBLIC -fmodules-ts "-fmodule-mapper=${module_mapper}" )
+    target_link_libraries  ( ${module_target} PUBLIC ${package_name} )
+
+else()
+    message( WARNING "Module '${module_name}': not supported for this compiler and CMake version" )
+endif()
+
+if ( TARGET ${module_target} )
+    add_library( ${package_nspace}::${module_target} ALIAS ${module_target} )
+endif()
+
+# end of file
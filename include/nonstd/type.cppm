@@ -0,0 +1,50 @@
+// Copyright 2018-2022 Martin Moene
+//
+// type-lite, strong types for C++98 and later.
+// For more information see https://github.com/martinmoene/type-lite
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// C++20 named module nonstd.type, exporting the contents of nonstd/type.hpp.
+//
+// The standard headers are included in the global module fragment, so that
+// their include guards keep them out of the module purview. Macros such as
+// type_DEFINE_FUNCTION() are not exported; include nonstd/type.hpp to use
+// them. In an importing translation unit, place #include directives before
+// the import declaration. Note: GCC 12 may fail on a translation unit that
+// instantiates standard library templates before importing the module.
+
+module;
+
+#include <compare>
+#include <cstddef>
+#include <functional>
+#include <type_traits>
+#include <utility>
+
+#if defined( type_CONFIG_COUNT_OPERATIONS ) && type_CONFIG_COUNT_OPERATIONS \
+ || defined( type_CONFIG_SAMPLE_VALUES    ) && type_CONFIG_SAMPLE_VALUES
+# include <algorithm>
+# include <atomic>
+# include <cstdint>
+# include <cstdlib>
+# include <cstring>
+# include <deque>
+# include <mutex>
+# include <ostream>
+# include <string>
+# include <typeinfo>
+# include <vector>
+# if defined(__GNUC__) || defined(__clang__)
+#  include <cxxabi.h>
+# endif
+#endif
+
+export module nonstd.type;
+
+export {
+#include "type.hpp"
+}
+
+// end of file
@@ -20,7 +20,29 @@
 
 // nonstd type configuration:
 
-// (none)
+// Count operator calls per strong type and operator (requires C++11):
+
+#ifndef  type_CONFIG_COUNT_OPERATIONS
+# define type_CONFIG_COUNT_OPERATIONS  0
+#endif
+
+// Sample every N-th value per thread and strong type into a histogram, 0: off (requires C++11):
+
+#ifndef  type_CONFIG_SAMPLE_VALUES
+# define type_CONFIG_SAMPLE_VALUES  0
+#endif
+
+// Provide std::hash<> and make_hash() from nonstd/type_hash.hpp, 0: include that header where needed:
+
+#ifndef  type_CONFIG_INCLUDE_STD_HASH
+# define type_CONFIG_INCLUDE_STD_HASH  1
+#endif
+
+// Constrain via C++20 concepts when available, 0: via std::enable_if<> (SFINAE):
+
+#ifndef  type_CONFIG_CONCEPTS
+# define type_CONFIG_CONCEPTS  1
+#endif
 
 // C++ language version detection (C++23 is speculative):
 // Note: VC14.0/1900 (VS2015) lacks too much from C++14.
@@ -120,6 +142,31 @@
 
 // no flag
 
+// Presence of C++20 language features:
+
+#if defined( __cpp_concepts ) && type_CPP20_OR_GREATER
+# define type_HAVE_CONCEPTS             ( __cpp_concepts >= 201907L )
+#else
+# define type_HAVE_CONCEPTS             0
+#endif
+
+#if defined( __cpp_impl_three_way_comparison ) && type_HAVE_CONCEPTS
+# define type_HAVE_THREE_WAY_COMPARISON ( __cpp_impl_three_way_comparison >= 201907L )
+#else
+# define type_HAVE_THREE_WAY_COMPARISON 0
+#endif
+
+// Presence of a test for constant evaluation, to keep instrumentation out of
+// constant expressions: compiler extension, or C++20 std::is_constant_evaluated():
+
+#if type_COMPILER_GNUC_VERSION >= 900 || type_COMPILER_CLANG_VERSION >= 900 || type_COMPILER_MSVC_VER >= 1925
+# define type_HAVE_BUILTIN_IS_CONSTANT_EVALUATED  1
+#else
+# define type_HAVE_BUILTIN_IS_CONSTANT_EVALUATED  0
+#endif
+
+#define type_HAVE_IS_CONSTANT_EVALUATED  ( type_HAVE_BUILTIN_IS_CONSTANT_EVALUATED || type_CPP20_OR_GREATER )
+
 // Presence of C++ library features:
 
 #define type_HAVE_STD_HASH              type_CPP11_120
@@ -152,20 +199,57 @@
 
 #if type_HAVE_NOEXCEPT
 # define type_noexcept  noexcept
+# define type_noexcept_op(expr)  noexcept(expr)
 #else
 # define type_noexcept  /*noexcept*/
+# define type_noexcept_op(expr)  /*noexcept(expr)*/
+#endif
+
+#if type_HAVE_BUILTIN_IS_CONSTANT_EVALUATED
+# define type_is_constant_evaluated()  __builtin_is_constant_evaluated()
+#elif type_HAVE_IS_CONSTANT_EVALUATED
+# define type_is_constant_evaluated()  std::is_constant_evaluated()
+#else
+# define type_is_constant_evaluated()  false
 #endif
 
 // Additional includes:
 
+#include "type_fwd.hpp"
+
 #if type_HAVE_STD_HASH
-# include <functional>      // std::hash<>
 # include <utility>         // std::move(), std::swap()
 # include <type_traits>     // std::is_same<>
 #else
 # include <algorithm>       // std::swap()
 #endif
 
+#if type_HAVE_THREE_WAY_COMPARISON
+# include <compare>         // std::three_way_comparable<>
+#endif
+
+#define type_HAVE_INSTRUMENTATION  ( type_CONFIG_COUNT_OPERATIONS || type_CONFIG_SAMPLE_VALUES )
+
+#if type_HAVE_INSTRUMENTATION
+# if ! type_CPP11_OR_GREATER
+#  error type-lite: type_CONFIG_COUNT_OPERATIONS and type_CONFIG_SAMPLE_VALUES require C++11 or later
+# endif
+# include <algorithm>       // std::find(), std::find_if()
+# include <atomic>
+# include <cstdint>         // std::uint64_t
+# include <cstring>         // std::strcmp()
+# include <deque>
+# include <mutex>
+# include <ostream>
+# include <string>
+# include <typeinfo>
+# include <vector>
+# if defined(__GNUC__) || defined(__clang__)
+#  include <cxxabi.h>       // abi::__cxa_demangle()
+#  include <cstdlib>        // std::free()
+# endif
+#endif
+
 // Method enabling
 
 #if type_CPP11_OR_GREATER
@@ -184,6 +268,43 @@
 
 #endif
 
+#define type_USES_CONCEPTS  ( type_CONFIG_CONCEPTS && type_HAVE_CONCEPTS )
+
+// Default constructor enabling unless D is no_default_t; type_DEFAULT_REQUIRES_0
+// precedes the constructor (SFINAE), type_DEFAULT_REQUIRES follows its parameter
+// list (requires-clause):
+
+#if type_USES_CONCEPTS
+# define type_DEFAULT_REQUIRES_0( D )  /*requires-clause*/
+# define type_DEFAULT_REQUIRES( D )    requires ::nonstd::types::default_policy<D>
+#elif type_CPP11_OR_GREATER
+# define type_DEFAULT_REQUIRES_0( D )  type_REQUIRES_0( ! std::is_same<D, ::nonstd::types::no_default_t>::value )
+# define type_DEFAULT_REQUIRES( D )    /*enable_if*/
+#else
+# define type_DEFAULT_REQUIRES_0( D )  /*no constraint*/
+# define type_DEFAULT_REQUIRES( D )    /*no constraint*/
+#endif
+
+/**
+ * count an operator call for strong type R, when so configured; not during
+ * constant evaluation.
+ */
+#if type_CONFIG_COUNT_OPERATIONS
+# define type_COUNT_OPERATION( R, op )  ( type_is_constant_evaluated() ? void() : ::nonstd::types::detail::count_operation<R>( ::nonstd::types::op ) )
+#else
+# define type_COUNT_OPERATION( R, op )  /*uncounted*/
+#endif
+
+/**
+ * sample a value of strong type S on its way to construction, when so
+ * configured; not during constant evaluation.
+ */
+#if type_CONFIG_SAMPLE_VALUES
+# define type_SAMPLED( S, v )  ( type_is_constant_evaluated() ? v : ::nonstd::types::detail::sampled<S>( v ) )
+#else
+# define type_SAMPLED( S, v )  v
+#endif
+
 /**
  * define a type's tag: used to prevent locally-defined struct in C++98.
  */
@@ -250,58 +371,585 @@
  */
 namespace nonstd { namespace types {
 
+#if type_HAVE_INSTRUMENTATION
+
+namespace detail {
+
+// readable type name:
+
+inline std::string demangle( char const * name )
+{
+#if defined(__GNUC__) || defined(__clang__)
+    int status = 0;
+    char * readable = abi::__cxa_demangle( name, nullptr, nullptr, &status );
+
+    if ( readable )
+    {
+        std::string result( readable );
+        std::free( readable );
+        return result;
+    }
+#endif
+    return name;
+}
+
+} // namespace detail
+
+#endif // type_HAVE_INSTRUMENTATION
+
+#if type_CONFIG_COUNT_OPERATIONS
+
+/**
+ * operators counted per strong type.
+ */
+enum counted_operation
+{
+    op_eq, op_ne, op_lt, op_le, op_gt, op_ge, op_cmp,
+    op_not, op_and, op_or,
+    op_add, op_sub, op_mul, op_div, op_mod,
+    op_bitand, op_bitor, op_bitxor, op_shl, op_shr,
+    op_count_
+};
+
+inline char const * operation_name( counted_operation op ) type_noexcept
+{
+    static char const * const names[] =
+    {
+        "==", "!=", "<", "<=", ">", ">=", "<=>",
+        "!", "&&", "||",
+        "+", "-", "*", "/", "%",
+        "&", "|", "^", "<<", ">>",
+    };
+    return names[ op ];
+}
+
+/**
+ * call count of an operator of a strong type, summed over all threads;
+ * type_name is that of the type<T,Tag,D> base of the strong type.
+ */
+struct operation_count
+{
+    std::string         type_name;
+    counted_operation   op;
+    std::uint64_t       count;
+};
+
+namespace detail {
+
+// operators are counted per type<T,Tag,D>, the base of every strong type family:
+
+template< typename T, typename Tag, typename D >
+type<T,Tag,D> counted_type_of( type<T,Tag,D> const * );
+
+template< typename R >
+struct counted_type
+{
+    typedef decltype( counted_type_of( static_cast<R const *>( nullptr ) ) ) type;
+};
+
+// counters of a strong type on one thread; only that thread increments them:
+
+struct operation_counters
+{
+    explicit operation_counters( char const * name_ )
+        : name( name_ )
+    {
+        for ( std::atomic<std::uint64_t> & c : count )
+            c.store( 0, std::memory_order_relaxed );
+    }
+
+    char const * name;
+    std::atomic<std::uint64_t> count[ op_count_ ];
+};
+
+// all counters: those of running threads and, per type, those of exited threads:
+
+class operation_registry
+{
+public:
+    static operation_registry & instance()
+    {
+        static operation_registry registry;
+        return registry;
+    }
+
+    void add( operation_counters * c )
+    {
+        std::lock_guard<std::mutex> lock( mutex );
+        live.push_back( c );
+    }
+
+    void retire( operation_counters * c )
+    {
+        std::lock_guard<std::mutex> lock( mutex );
+
+        live.erase( std::find( live.begin(), live.end(), c ) );
+        operation_counters & r = retired_counters( c->name );
+
+        for ( int op = 0; op != op_count_; ++op )
+            r.count[op].fetch_add( c->count[op].load( std::memory_order_relaxed ), std::memory_order_relaxed );
+    }
+
+    template< typename F >
+    void for_each( F f )
+    {
+        std::lock_guard<std::mutex> lock( mutex );
+
+        for ( operation_counters * c : live )
+            f( *c );
+        for ( operation_counters & c : retired )
+            f( c );
+    }
+
+private:
+    operation_counters & retired_counters( char const * name )
+    {
+        for ( operation_counters & c : retired )
+        {
+            if ( std::strcmp( c.name, name ) == 0 )
+                return c;
+        }
+        retired.emplace_back( name );
+        return retired.back();
+    }
+
+    std::mutex mutex;
+    std::vector<operation_counters *> live;
+    std::deque<operation_counters> retired;      // stable addresses, no moves
+};
+
+// a thread's counters of strong type R, registered while the thread runs:
+
+template< typename R >
+struct thread_operation_counters : operation_counters
+{
+    thread_operation_counters()
+        : operation_counters( typeid( R ).name() )
+    {
+        operation_registry::instance().add( this );
+    }
+
+    ~thread_operation_counters()
+    {
+        operation_registry::instance().retire( this );
+    }
+};
+
+// the first call per thread registers the counters, which may throw:
+
+template< typename R >
+inline void count_operation( counted_operation op )
+{
+    static thread_local thread_operation_counters< typename counted_type<R>::type > counters;
+
+    std::atomic<std::uint64_t> & c = counters.count[ op ];
+    c.store( c.load( std::memory_order_relaxed ) + 1, std::memory_order_relaxed );
+}
+
+} // namespace detail
+
+/**
+ * number of calls of operator op of strong type R, over all threads.
+ */
+template< typename R >
+inline std::uint64_t operation_count_of( counted_operation op )
+{
+    char const * const name = typeid( typename detail::counted_type<R>::type ).name();
+    std::uint64_t sum = 0;
+
+    detail::operation_registry::instance().for_each( [&]( detail::operation_counters const & c )
+    {
+        if ( std::strcmp( c.name, name ) == 0 )
+            sum += c.count[ op ].load( std::memory_order_relaxed );
+    });
+    return sum;
+}
+
+/**
+ * non-zero call counts of all strong types and operators, over all threads.
+ */
+inline std::vector<operation_count> operation_counts()
+{
+    std::vector<operation_count> result;
+
+    detail::operation_registry::instance().for_each( [&]( detail::operation_counters const & c )
+    {
+        for ( int i = 0; i != op_count_; ++i )
+        {
+            counted_operation const op = static_cast<counted_operation>( i );
+            std::uint64_t const n = c.count[ op ].load( std::memory_order_relaxed );
+
+            if ( n == 0 )
+                continue;
+
+            std::string const type_name = detail::demangle( c.name );
+
+            std::vector<operation_count>::iterator pos = std::find_if( result.begin(), result.end(),
+                [&]( operation_count const & e ) { return e.op == op && e.type_name == type_name; } );
+
+            if ( pos != result.end() )
+                pos->count += n;
+            else
+                result.push_back( operation_count{ type_name, op, n } );
+        }
+    });
+    return result;
+}
+
+/**
+ * zero all counts; increments concurrent with the reset may be lost.
+ */
+inline void reset_operation_counts()
+{
+    detail::operation_registry::instance().for_each( []( detail::operation_counters & c )
+    {
+        for ( std::atomic<std::uint64_t> & n : c.count )
+            n.store( 0, std::memory_order_relaxed );
+    });
+}
+
+/**
+ * write the non-zero call counts, one 'type operator count' line each.
+ */
+inline std::ostream & dump_operation_counts( std::ostream & os )
+{
+    std::vector<operation_count> const counts = operation_counts();
+
+    for ( operation_count const & e : counts )
+        os << e.type_name << ' ' << operation_name( e.op ) << ' ' << e.count << '\n';
+
+    return os;
+}
+
+#endif // type_CONFIG_COUNT_OPERATIONS
+
+#if type_CONFIG_SAMPLE_VALUES
+
+/**
+ * histogram bucket of sampled values: magnitudes [lowest..highest], of
+ * negative values if negative; buckets are exact below 16 and 1/16 of a
+ * power of two wide above.
+ */
+struct value_bucket
+{
+    bool            negative;
+    std::uint64_t   lowest;
+    std::uint64_t   highest;
+    std::uint64_t   count;
+};
+
+/**
+ * histogram of the sampled values of a strong type, non-empty buckets in
+ * ascending order of value; type_name is that of its type<T,Tag,D>.
+ */
+struct value_histogram
+{
+    std::string                 type_name;
+    std::uint64_t               samples;
+    std::vector<value_bucket>   buckets;
+};
+
+namespace detail {
+
+// log-linear buckets: 16 exact, then 16 per power of two from 2^4 to 2^63:
+
+const std::size_t histogram_buckets = 16 + 60 * 16;
+
+inline unsigned histogram_log2( std::uint64_t m ) type_noexcept
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return 63u - static_cast<unsigned>( __builtin_clzll( m ) );
+#else
+    unsigned n = 0;
+    while ( m >>= 1 )
+        ++n;
+    return n;
+#endif
+}
+
+inline std::size_t histogram_bucket( std::uint64_t m ) type_noexcept
+{
+    if ( m < 16 )
+        return static_cast<std::size_t>( m );
+
+    unsigned const e = histogram_log2( m );
+    return 16 + ( e - 4 ) * 16 + static_cast<std::size_t>( ( m >> ( e - 4 ) ) & 15 );
+}
+
+inline std::uint64_t histogram_lowest( std::size_t i ) type_noexcept
+{
+    if ( i < 16 )
+        return i;
+
+    unsigned const e = static_cast<unsigned>( ( i - 16 ) / 16 + 4 );
+    return ( 16 + ( i - 16 ) % 16 ) << ( e - 4 );
+}
+
+inline std::uint64_t histogram_highest( std::size_t i ) type_noexcept
+{
+    if ( i < 16 )
+        return i;
+
+    unsigned const e = static_cast<unsigned>( ( i - 16 ) / 16 + 4 );
+    return histogram_lowest( i ) + ( ( std::uint64_t(1) << ( e - 4 ) ) - 1 );
+}
+
+// lock-free histogram of a strong type, shared by all threads:
+
+struct sample_histogram
+{
+    explicit sample_histogram( char const * name_ )
+        : name( name_ )
+    {
+        clear();
+    }
+
+    void clear() type_noexcept
+    {
+        for ( std::atomic<std::uint64_t> & c : count[0] )
+            c.store( 0, std::memory_order_relaxed );
+        for ( std::atomic<std::uint64_t> & c : count[1] )
+            c.store( 0, std::memory_order_relaxed );
+    }
+
+    void add( bool negative, std::uint64_t magnitude ) type_noexcept
+    {
+        count[ negative ][ histogram_bucket( magnitude ) ].fetch_add( 1, std::memory_order_relaxed );
+    }
+
+    char const * name;
+    std::atomic<std::uint64_t> count[2][ histogram_buckets ];   // non-negative, negative
+};
+
+class sample_registry
+{
+public:
+    static sample_registry & instance()
+    {
+        static sample_registry registry;
+        return registry;
+    }
+
+    void add( sample_histogram * h )
+    {
+        std::lock_guard<std::mutex> lock( mutex );
+        all.push_back( h );
+    }
+
+    template< typename F >
+    void for_each( F f )
+    {
+        std::lock_guard<std::mutex> lock( mutex );
+
+        for ( sample_histogram * h : all )
+            f( *h );
+    }
+
+private:
+    std::mutex mutex;
+    std::vector<sample_histogram *> all;
+};
+
+template< typename S >
+struct registered_histogram : sample_histogram
+{
+    registered_histogram()
+        : sample_histogram( typeid( S ).name() )
+    {
+        sample_registry::instance().add( this );
+    }
+};
+
+template< typename S >
+inline sample_histogram & histogram_of()
+{
+    static registered_histogram<S> histogram;
+    return histogram;
+}
+
+// sign and magnitude of arithmetic values, saturating for floating point:
+
+template< typename T >
+inline void record_value( sample_histogram & h, T const & v, std::true_type /*integral*/ ) type_noexcept
+{
+    bool const negative = v < T();
+    std::uint64_t const m = static_cast<std::uint64_t>( v );
+
+    h.add( negative, negative ? 0 - m : m );
+}
+
+template< typename T >
+inline void record_value( sample_histogram & h, T const & v, std::false_type /*floating point*/ ) type_noexcept
+{
+    bool const negative = v < T();
+    T const a = negative ? -v : v;
+
+    h.add( negative, a < T( 18446744073709551615.0 ) ? static_cast<std::uint64_t>( a ) : ~std::uint64_t(0) );
+}
+
+template< typename S, typename T >
+inline void sample_value( T const & v, std::true_type /*arithmetic*/ )
+{
+    static thread_local unsigned skip = 0;
+
+    if ( skip != 0 )
+    {
+        --skip;
+        return;
+    }
+    skip = static_cast<unsigned>( type_CONFIG_SAMPLE_VALUES ) - 1u;
+
+    record_value( histogram_of<S>(), v, std::integral_constant<bool, std::is_integral<T>::value>() );
+}
+
+template< typename S, typename T >
+inline void sample_value( T const &, std::false_type /*arithmetic*/ ) type_noexcept {}
+
+template< typename S, typename T >
+inline void sample_value( T const & v )
+{
+    sample_value<S>( v, std::integral_constant<bool, std::is_arithmetic<T>::value>() );
+}
+
+template< typename S, typename T >
+inline T && sampled( T && v )
+{
+    sample_value<S>( v );
+    return std::forward<T>( v );
+}
+
+} // namespace detail
+
+/**
+ * histograms of all sampled strong types.
+ */
+inline std::vector<value_histogram> value_histograms()
+{
+    std::vector<value_histogram> result;
+
+    detail::sample_registry::instance().for_each( [&]( detail::sample_histogram const & h )
+    {
+        value_histogram hist = { detail::demangle( h.name ), 0, std::vector<value_bucket>() };
+
+        for ( std::size_t i = detail::histogram_buckets; i-- != 0; )
+        {
+            std::uint64_t const n = h.count[1][i].load( std::memory_order_relaxed );
+            if ( n != 0 )
+                hist.buckets.push_back( value_bucket{ true, detail::histogram_lowest( i ), detail::histogram_highest( i ), n } );
+        }
+
+        for ( std::size_t i = 0; i != detail::histogram_buckets; ++i )
+        {
+            std::uint64_t const n = h.count[0][i].load( std::memory_order_relaxed );
+            if ( n != 0 )
+                hist.buckets.push_back( value_bucket{ false, detail::histogram_lowest( i ), detail::histogram_highest( i ), n } );
+        }
+
+        for ( value_bucket const & b : hist.buckets )
+            hist.samples += b.count;
+
+        if ( hist.samples != 0 )
+            result.push_back( hist );
+    });
+    return result;
+}
+
+/**
+ * zero all histograms; samples concurrent with the reset may be kept.
+ */
+inline void reset_value_histograms()
+{
+    detail::sample_registry::instance().for_each( []( detail::sample_histogram & h )
+    {
+        h.clear();
+    });
+}
+
+/**
+ * write the histograms: a 'type samples' line per strong type, followed by
+ * a 'lowest highest count' line per non-empty bucket.
+ */
+inline std::ostream & dump_value_histograms( std::ostream & os )
+{
+    std::vector<value_histogram> const histograms = value_histograms();
+
+    for ( value_histogram const & h : histograms )
+    {
+        os << h.type_name << ' ' << h.samples << '\n';
+
+        for ( value_bucket const & b : h.buckets )
+        {
+            if ( b.negative )
+                os << "  -" << b.highest << " -" << b.lowest << ' ' << b.count << '\n';
+            else
+                os << "  "  << b.lowest  << ' '  << b.highest << ' ' << b.count << '\n';
+        }
+    }
+    return os;
+}
+
+#endif // type_CONFIG_SAMPLE_VALUES
+
 // EqualityComparable, comparison functions based on operator==() and operator<():
 
-template< typename T, typename U = T > struct is_eq   { friend type_constexpr14 bool operator==( T const & x, U const & y ) { return x.get() == y.get(); } };
-template< typename T, typename U = T > struct is_lt   { friend type_constexpr14 bool operator< ( T const & x, U const & y ) { return x.get() <  y.get(); } };
+template< typename T, typename U = T > struct is_eq   { friend type_constexpr14 bool operator==( T const & x, U const & y ) { type_COUNT_OPERATION( T, op_eq ); return x.get() == y.get(); } };
+template< typename T, typename U = T > struct is_lt   { friend type_constexpr14 bool operator< ( T const & x, U const & y ) { type_COUNT_OPERATION( T, op_lt ); return x.get() <  y.get(); } };
 
-template< typename T, typename U = T > struct is_ne   { friend type_constexpr14 bool operator!=( T const & x, U const & y ) { return ! ( x == y ); } };
-template< typename T, typename U = T > struct is_lteq { friend type_constexpr14 bool operator> ( T const & x, U const & y ) { return     y <  x;   } };
-template< typename T, typename U = T > struct is_gt   { friend type_constexpr14 bool operator<=( T const & x, U const & y ) { return ! ( y <  x ); } };
-template< typename T, typename U = T > struct is_gteq { friend type_constexpr14 bool operator>=( T const & x, U const & y ) { return ! ( x <  y ); } };
+template< typename T, typename U = T > struct is_ne   { friend type_constexpr14 bool operator!=( T const & x, U const & y ) { type_COUNT_OPERATION( T, op_ne ); return ! ( x.get() == y.get() ); } };
+template< typename T, typename U = T > struct is_lteq { friend type_constexpr14 bool operator> ( T const & x, U const & y ) { type_COUNT_OPERATION( T, op_gt ); return     y.get() <  x.get();   } };
+template< typename T, typename U = T > struct is_gt   { friend type_constexpr14 bool operator<=( T const & x, U const & y ) { type_COUNT_OPERATION( T, op_le ); return ! ( y.get() <  x.get() ); } };
+template< typename T, typename U = T > struct is_gteq { friend type_constexpr14 bool operator>=( T const & x, U const & y ) { type_COUNT_OPERATION( T, op_ge ); return ! ( x.get() <  y.get() ); } };
+
+#if type_HAVE_THREE_WAY_COMPARISON
+
+// Three-way comparison, forwarded to that of the underlying type if it has one:
+
+template< typename T, typename U = T > struct is_cmp  { friend constexpr auto operator<=>( T const & x, U const & y ) requires std::three_way_comparable< typename T::underlying_type > { type_COUNT_OPERATION( T, op_cmp ); return x.get() <=> y.get(); } };
+
+#endif
 
 // Logical operations:
 
-template< typename R, typename T = R > struct logical_not{ friend type_constexpr14 R operator!( T const & x ) { return R( ! x.get() ); } };
+template< typename R, typename T = R > struct logical_not{ friend type_constexpr14 R operator!( T const & x ) { type_COUNT_OPERATION( R, op_not ); return R( ! x.get() ); } };
 
-template< typename R, typename T = R, typename U = R > struct logical_and{ friend type_constexpr14 R operator&&( T const & x, U const & y ) { return R( x.get() && y.get() ); } };
-template< typename R, typename T = R, typename U = R > struct logical_or { friend type_constexpr14 R operator||( T const & x, U const & y ) { return R( x.get() || y.get() ); } };
+template< typename R, typename T = R, typename U = R > struct logical_and{ friend type_constexpr14 R operator&&( T const & x, U const & y ) { type_COUNT_OPERATION( R, op_and ); return R( x.get() && y.get() ); } };
+template< typename R, typename T = R, typename U = R > struct logical_or { friend type_constexpr14 R operator||( T const & x, U const & y ) { type_COUNT_OPERATION( R, op_or ); return R( x.get() || y.get() ); } };
 
 // Arithmetic operations based on operator X=():
 
-template< typename R, typename T = R, typename U = R > struct plus       { friend type_constexpr14 R operator+( T x, U const & y ) { return x += y; } };
-template< typename R, typename T = R, typename U = R > struct plus2      { friend type_constexpr14 R operator+( T const & x, U y ) { return y += x; } };
-template< typename R, typename T = R, typename U = R > struct minus      { friend type_constexpr14 R operator-( T x, U const & y ) { return x -= y; } };
-template< typename R, typename T = R, typename U = R > struct multiplies { friend type_constexpr14 R operator*( T x, U const & y ) { return x *= y; } };
-template< typename R, typename T = R, typename U = R > struct multiplies2{ friend type_constexpr14 R operator*( T const & x, U y ) { return y *= x; } };
-template< typename R, typename T = R, typename U = R > struct divides    { friend type_constexpr14 R operator/( T x, U const & y ) { return x /= y; } };
-template< typename R, typename T = R, typename U = R > struct modulus    { friend type_constexpr14 R operator%( T x, U const & y ) { return x %= y; } };
+template< typename R, typename T = R, typename U = R > struct plus       { friend type_constexpr14 R operator+( T x, U const & y ) { type_COUNT_OPERATION( R, op_add ); return x += y; } };
+template< typename R, typename T = R, typename U = R > struct plus2      { friend type_constexpr14 R operator+( T const & x, U y ) { type_COUNT_OPERATION( R, op_add ); return y += x; } };
+template< typename R, typename T = R, typename U = R > struct minus      { friend type_constexpr14 R operator-( T x, U const & y ) { type_COUNT_OPERATION( R, op_sub ); return x -= y; } };
+template< typename R, typename T = R, typename U = R > struct multiplies { friend type_constexpr14 R operator*( T x, U const & y ) { type_COUNT_OPERATION( R, op_mul ); return x *= y; } };
+template< typename R, typename T = R, typename U = R > struct multiplies2{ friend type_constexpr14 R operator*( T const & x, U y ) { type_COUNT_OPERATION( R, op_mul ); return y *= x; } };
+template< typename R, typename T = R, typename U = R > struct divides    { friend type_constexpr14 R operator/( T x, U const & y ) { type_COUNT_OPERATION( R, op_div ); return x /= y; } };
+template< typename R, typename T = R, typename U = R > struct modulus    { friend type_constexpr14 R operator%( T x, U const & y ) { type_COUNT_OPERATION( R, op_mod ); return x %= y; } };
 
 // Bitwise operations based on operator X=():
 
 //template< typename R, typename T = R > struct bit_not{ friend type_constexpr14 R operator~( T const & x ) { return ~x; }; };
 
-template< typename R, typename T = R, typename U = R > struct bit_and { friend type_constexpr14 R operator&( T x, U const & y ) { return x &= y; } };
-template< typename R, typename T = R, typename U = R > struct bit_or  { friend type_constexpr14 R operator|( T x, U const & y ) { return x |= y; } };
-template< typename R, typename T = R, typename U = R > struct bit_xor { friend type_constexpr14 R operator^( T x, U const & y ) { return x ^= y; } };
+template< typename R, typename T = R, typename U = R > struct bit_and { friend type_constexpr14 R operator&( T x, U const & y ) { type_COUNT_OPERATION( R, op_bitand ); return x &= y; } };
+template< typename R, typename T = R, typename U = R > struct bit_or  { friend type_constexpr14 R operator|( T x, U const & y ) { type_COUNT_OPERATION( R, op_bitor ); return x |= y; } };
+template< typename R, typename T = R, typename U = R > struct bit_xor { friend type_constexpr14 R operator^( T x, U const & y ) { type_COUNT_OPERATION( R, op_bitxor ); return x ^= y; } };
 
-template< typename R, typename T = R > struct bit_shl { friend type_constexpr14 R operator<<( T x, int const n ) { return x <<= n; } };
-template< typename R, typename T = R > struct bit_shr { friend type_constexpr14 R operator>>( T x, int const n ) { return x >>= n; } };
+template< typename R, typename T = R > struct bit_shl { friend type_constexpr14 R operator<<( T x, int const n ) { type_COUNT_OPERATION( R, op_shl ); return x <<= n; } };
+template< typename R, typename T = R > struct bit_shr { friend type_constexpr14 R operator>>( T x, int const n ) { type_COUNT_OPERATION( R, op_shr ); return x >>= n; } };
 
-/**
- * disallow default construction.
- */
-struct no_default_t{};
+#if type_USES_CONCEPTS
 
 /**
- * custom default value
+ * default construction policy D permits default construction.
  */
-template<typename T, T Val> struct custom_default_t{};
+template< typename D >
+concept default_policy = ! std::is_same<D, no_default_t>::value;
+
+#endif // type_USES_CONCEPTS
 
 /**
  * data base class.
  */
-template< typename T, typename D = T >
+template< typename T, typename D >
 struct data
 {
     typedef T underlying_type;
@@ -331,7 +979,13 @@ struct data
     type_constexpr14 T const  & get() const { return value; }
 #endif
 
+#if type_CPP17_OR_GREATER
+    void swap( data & other ) type_noexcept_op( std::is_nothrow_swappable<T>::value )
+#elif type_CPP11_OR_GREATER
+    void swap( data & other ) type_noexcept_op( std::is_nothrow_move_constructible<T>::value && std::is_nothrow_move_assignable<T>::value )
+#else
     void swap( data & other )
+#endif
     {
         using std::swap;
         swap( this->value, other.value );
@@ -362,33 +1016,30 @@ struct default_value< T, custom_default_t< T, Val > >
 /**
  * type, no operators.
  */
-template< typename T, typename Tag, typename D = T >
+template< typename T, typename Tag, typename D >
 struct type : data<T,D>
 {
-#if type_CPP11_OR_GREATER
-    type_REQUIRES_0((
-        ! std::is_same<D, no_default_t>::value
-    ))
-#endif
-    type_constexpr type()
+    type_DEFAULT_REQUIRES_0( D )
+    type_constexpr type() type_DEFAULT_REQUIRES( D )
         : data<T,D>( default_value<T,D>::get() )
     {}
 
 #if  type_CPP11_OR_GREATER
     type_constexpr explicit type( T v )
-        : data<T,D>( std::move(v) )
+        : data<T,D>( type_SAMPLED( type, std::move(v) ) )
     {}
 #else
     type_constexpr explicit type( T const & v )
         : data<T,D>( v )
     {}
 #endif
+
 };
 
 /**
  * boolean.
  */
-template< typename Tag, typename D = bool >
+template< typename Tag, typename D >
 struct boolean
     : type < bool,Tag,D >
     , is_eq< boolean<Tag,D> >
@@ -407,12 +1058,8 @@ private:
 public:
     // default/initializing constructor.
 
-#if type_CPP11_OR_GREATER
-    type_REQUIRES_0(
-        ! std::is_same<D, no_default_t>::value
-    )
-#endif
-    type_constexpr boolean()
+    type_DEFAULT_REQUIRES_0( D )
+    type_constexpr boolean() type_DEFAULT_REQUIRES( D )
         : type<bool,Tag,D>()
     {}
 
@@ -438,19 +1085,15 @@ public:
 /**
  * logical, ...
  */
-template< typename T, typename Tag, typename D = T >
+template< typename T, typename Tag, typename D >
 struct logical
     : type< T,Tag,D >
-    , logical_not< type<T,Tag,D> >
-    , logical_and< type<T,Tag,D> >
-    , logical_or < type<T,Tag,D> >
+    , logical_not< logical<T,Tag,D> >
+    , logical_and< logical<T,Tag,D> >
+    , logical_or < logical<T,Tag,D> >
 {
-#if type_CPP11_OR_GREATER
-    type_REQUIRES_0(
-        ! std::is_same<D, no_default_t>::value
-    )
-#endif
-    type_constexpr logical()
+    type_DEFAULT_REQUIRES_0( D )
+    type_constexpr logical() type_DEFAULT_REQUIRES( D )
         : type<T,Tag,D>()
     {}
 
@@ -468,18 +1111,14 @@ struct logical
 /**
  * equality, EqualityComparable.
  */
-template< typename T, typename Tag, typename D = T >
+template< typename T, typename Tag, typename D >
 struct equality
     : type<T,Tag,D>
     , is_eq< equality<T,Tag,D> >
     , is_ne< equality<T,Tag,D> >
 {
-#if type_CPP11_OR_GREATER
-    type_REQUIRES_0(
-        ! std::is_same<D, no_default_t>::value
-    )
-#endif
-    type_constexpr equality()
+    type_DEFAULT_REQUIRES_0( D )
+    type_constexpr equality() type_DEFAULT_REQUIRES( D )
         : type<T,Tag,D>()
     {}
 
@@ -497,7 +1136,7 @@ struct equality
 /**
  * bits, EqualityComparable and bitwise operators.
  */
-template< typename T, typename Tag, typename D = T >
+template< typename T, typename Tag, typename D >
 struct bits
     : equality< T,Tag,D >
 //  , bit_not < bits<T,Tag,D> >
@@ -507,12 +1146,8 @@ struct bits
     , bit_shl < bits<T,Tag,D> >
     , bit_shr < bits<T,Tag,D> >
 {
-#if type_CPP11_OR_GREATER
-    type_REQUIRES_0(
-        ! std::is_same<D, no_default_t>::value
-    )
-#endif
-    type_constexpr bits()
+    type_DEFAULT_REQUIRES_0( D )
+    type_constexpr bits() type_DEFAULT_REQUIRES( D )
         : equality<T,Tag,D>()
     {}
 
@@ -526,7 +1161,7 @@ struct bits
     {}
 #endif
 
-    type_constexpr14 bits   operator~ () { return bits( static_cast<T>( ~this->get() ) ); }
+    type_constexpr14 bits   operator~ () const { return bits( static_cast<T>( ~this->get() ) ); }
 
     type_constexpr14 bits & operator^=( bits const & other ) { this->get() = this->get() ^ other.get(); return *this; }
     type_constexpr14 bits & operator&=( bits const & other ) { this->get() = this->get() & other.get(); return *this; }
@@ -539,20 +1174,19 @@ struct bits
 /**
  * ordered, LessThanComparable.
  */
-template< typename T, typename Tag, typename D = T >
+template< typename T, typename Tag, typename D >
 struct ordered
     : equality<T,Tag,D>
     , is_lt   < ordered<T,Tag,D> >
     , is_gt   < ordered<T,Tag,D> >
     , is_lteq < ordered<T,Tag,D> >
     , is_gteq < ordered<T,Tag,D> >
-{
-#if type_CPP11_OR_GREATER
-    type_REQUIRES_0(
-        ! std::is_same<D, no_default_t>::value
-    )
+#if type_HAVE_THREE_WAY_COMPARISON
+    , is_cmp  < ordered<T,Tag,D> >
 #endif
-    type_constexpr ordered()
+{
+    type_DEFAULT_REQUIRES_0( D )
+    type_constexpr ordered() type_DEFAULT_REQUIRES( D )
         : equality<T,Tag,D>()
     {}
 
@@ -570,7 +1204,7 @@ struct ordered
 /**
  * numeric, LessThanComparable and ...
  */
-template< typename T, typename Tag, typename D = T >
+template< typename T, typename Tag, typename D >
 struct numeric
     : ordered   < T,Tag,D >
     , plus      < numeric<T,Tag,D> >
@@ -579,12 +1213,8 @@ struct numeric
     , divides   < numeric<T,Tag,D> >
     , modulus   < numeric<T,Tag,D> >
 {
-#if type_CPP11_OR_GREATER
-    type_REQUIRES_0(
-        ! std::is_same<D, no_default_t>::value
-    )
-#endif
-    type_constexpr numeric()
+    type_DEFAULT_REQUIRES_0( D )
+    type_constexpr numeric() type_DEFAULT_REQUIRES( D )
         : ordered<T,Tag,D>()
     {}
 
@@ -617,7 +1247,7 @@ struct numeric
 /**
  * quantity, keep dimension.
  */
-template< typename T, typename Tag, typename D = T >
+template< typename T, typename Tag, typename D >
 struct quantity
     : ordered    < T,Tag,D >
     , plus       < quantity<T,Tag,D> >
@@ -627,12 +1257,8 @@ struct quantity
     , multiplies2< quantity<T,Tag,D>, T, quantity<T,Tag,D>    >
     , divides    < quantity<T,Tag,D>,    quantity<T,Tag,D>, T >
 {
-#if type_CPP11_OR_GREATER
-    type_REQUIRES_0(
-        ! std::is_same<D, no_default_t>::value
-    )
-#endif
-    type_constexpr quantity()
+    type_DEFAULT_REQUIRES_0( D )
+    type_constexpr quantity() type_DEFAULT_REQUIRES( D )
         : ordered<T,Tag,D>()
     {}
 
@@ -655,7 +1281,7 @@ struct quantity
     type_constexpr14 quantity & operator*=( T const & y ) { return this->get() *= y, *this; }
     type_constexpr14 quantity & operator/=( T const & y ) { return this->get() /= y, *this; }
 
-    type_constexpr14 T operator/( quantity const & y ) { return this->get() / y.get(); }
+    type_constexpr14 T operator/( quantity const & y ) const { return this->get() / y.get(); }
 };
 
 /**
@@ -664,18 +1290,14 @@ struct quantity
  * offset + offset  => offset
  * offset - offset  => offset
  */
-template< typename T, typename Tag, typename D = T >
+template< typename T, typename Tag, typename D >
 struct offset
     : ordered< T,Tag,D >
     , plus   < offset<T,Tag,D> >
     , minus  < offset<T,Tag,D> >
 {
-#if type_CPP11_OR_GREATER
-    type_REQUIRES_0(
-        ! std::is_same<D, no_default_t>::value
-    )
-#endif
-    type_constexpr offset()
+    type_DEFAULT_REQUIRES_0( D )
+    type_constexpr offset() type_DEFAULT_REQUIRES( D )
         : ordered<T,Tag,D>()
     {}
 
@@ -705,7 +1327,7 @@ struct offset
  *  offset + offset  => offset
  *  offset - offset  => offset
  */
-template< typename T, typename O, typename Tag, typename D = T >
+template< typename T, typename O, typename Tag, typename D >
 struct address
     : ordered< T,Tag,D >
     , plus < address<T,O,Tag,D>, address<T,O,Tag,D>, offset <  O,Tag,O> >
@@ -714,12 +1336,8 @@ struct address
 {
     typedef offset<O,Tag,O> offset_type;
 
-#if type_CPP11_OR_GREATER
-    type_REQUIRES_0(
-        ! std::is_same<D, no_default_t>::value
-    )
-#endif
-    type_constexpr address()
+    type_DEFAULT_REQUIRES_0( D )
+    type_constexpr address() type_DEFAULT_REQUIRES( D )
         : ordered<T,Tag,D>()
     {}
 
@@ -736,13 +1354,68 @@ struct address
     type_constexpr14 address & operator+=( offset_type const & y ) { this->get() += y.get(); return *this; }
     type_constexpr14 address & operator-=( offset_type const & y ) { this->get() -= y.get(); return *this; }
 
-    friend type_constexpr14 offset_type operator-( address const & x, address const & y ) { return offset_type( x.get() - y.get() ); }
+    friend type_constexpr14 offset_type operator-( address const & x, address const & y ) { type_COUNT_OPERATION( offset_type, op_sub ); return offset_type( x.get() - y.get() ); }
 };
 
 // swap values.
 
+#if type_USES_CONCEPTS
+
+namespace detail {
+
+// the type<T,Tag,D> base of a strong type, declaration only:
+
+template< typename T, typename Tag, typename D >
+type<T,Tag,D> strong_type_base( type<T,Tag,D> const * );
+
+} // namespace detail
+
+/**
+ * strong_type, a type of one of the families, or derived from one.
+ */
+template< typename S >
+concept strong_type = requires( S const * p ) { detail::strong_type_base( p ); };
+
+/**
+ * strong_equality, a strong type with == and !=.
+ */
+template< typename S >
+concept strong_equality = strong_type<S> && requires( S const & x, S const & y )
+{
+    x == y; x != y;
+};
+
+/**
+ * strong_ordered, a strong type with equality and <, <=, >, >=.
+ */
+template< typename S >
+concept strong_ordered = strong_equality<S> && requires( S const & x, S const & y )
+{
+    x < y; x <= y; x > y; x >= y;
+};
+
+/**
+ * strong_quantity, an ordered strong type with +, - and scaling by its underlying type.
+ */
+template< typename S >
+concept strong_quantity = strong_ordered<S> && requires( S x, S const & y, typename S::underlying_type const & v )
+{
+    x + y; x - y; x * v; x / v; x += y; x -= y; -x;
+};
+
+/**
+ * strong_numeric, an ordered strong type with +, -, *, / among its values.
+ */
+template< typename S >
+concept strong_numeric = strong_ordered<S> && requires( S x, S const & y )
+{
+    x + y; x - y; x * y; x / y; x += y; x -= y; x *= y; x /= y; -x;
+};
+
+#endif // type_USES_CONCEPTS
+
 template < typename T, typename Tag, typename D >
-inline type_constexpr14 void swap( type<T,Tag,D> & x, type<T,Tag,D> & y )
+inline type_constexpr14 void swap( type<T,Tag,D> & x, type<T,Tag,D> & y ) type_noexcept_op( noexcept( x.swap( y ) ) )
 {
     x.swap( y );
 }
@@ -769,77 +1442,45 @@ to_value( type<T,Tag,D> const & v )
 
 }}  // namespace nonstd::types
 
-#if type_HAVE_STD_HASH
-
-namespace std {
-
-template< typename T, typename Tag, typename D >
-struct hash< ::nonstd::types::type<T,Tag,D> >
-{
-public:
-    std::size_t operator()( ::nonstd::types::type<T,Tag,D> const & v ) const type_noexcept
-    {
-        return std::hash<T>()( v.get() );
-    }
-};
-
-}  // namespace std
-
-namespace nonstd { namespace types {
-
-template< typename T, typename Tag, typename D >
-std::size_t make_hash( type<T,Tag,D> const & v ) type_noexcept
-{
-    return std::hash<::nonstd::types::type<T,Tag,D> >()( v );
-}
-
-}} // namespace nonstd::types
-
-#endif // type_HAVE_STD_HASH
-
-// make type available in namespace nonstd:
+// make type available in namespace nonstd (families: see type_fwd.hpp):
 
 namespace nonstd {
 
-using types::no_default_t;
-using types::custom_default_t;
-
-using types::type;
-using types::bits;
-using types::boolean;
-using types::logical;
-using types::equality; // equal
-using types::ordered;
-using types::numeric;
-using types::quantity;
-
-using types::offset;
-using types::address;
-
 using types::swap;
 using types::to_value;
 
-#if type_HAVE_STD_HASH
-using types::make_hash;
+#if type_USES_CONCEPTS
+using types::default_policy;
+using types::strong_type;
+using types::strong_equality;
+using types::strong_ordered;
+using types::strong_quantity;
+using types::strong_numeric;
 #endif
-} // namespace nonstd
-
-// stream output.
-
-#if 0
 
-#include <ostream>
-
-namespace nonstd {
+#if type_CONFIG_COUNT_OPERATIONS
+using types::counted_operation;
+using types::operation_count;
+using types::operation_name;
+using types::operation_count_of;
+using types::operation_counts;
+using types::reset_operation_counts;
+using types::dump_operation_counts;
+#endif
 
-template< typename T, typename Tag, typename D >
-inline std::ostream & operator<<( std::ostream & os, type<T,Tag,D> v )
-{
-    return os << v.get();
-}
+#if type_CONFIG_SAMPLE_VALUES
+using types::value_bucket;
+using types::value_histogram;
+using types::value_histograms;
+using types::reset_value_histograms;
+using types::dump_value_histograms;
+#endif
+} // namespace nonstd
 
-}  // namespace nonstd::types
+// std::hash<> support:
 
+#if type_CONFIG_INCLUDE_STD_HASH
+# include "type_hash.hpp"
 #endif
 
 #endif // NONSTD_TYPE_HPP_INCLUDED
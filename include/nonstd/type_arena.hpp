@@ -0,0 +1,186 @@
+// Copyright 2018-2022 Martin Moene
+//
+// type-lite, strong types for C++98 and later.
+// For more information see https://github.com/martinmoene/type-lite
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef NONSTD_TYPE_ARENA_HPP_INCLUDED
+#define NONSTD_TYPE_ARENA_HPP_INCLUDED
+
+#include "type.hpp"
+
+#if type_CPP11_OR_GREATER
+
+#include <cassert>
+#include <cstddef>          // std::size_t, std::max_align_t
+#include <cstdint>          // std::uint32_t
+#include <limits>
+#include <memory>           // std::unique_ptr<>
+#include <utility>          // std::move()
+
+namespace nonstd { namespace types {
+
+/**
+ * arena, bump allocator handing out handles relative to its base.
+ *
+ * Handles are of type address<O,O,Tag>, so that a handle of a 32-bit arena
+ * takes 4 bytes instead of the 8 bytes of a pointer. Offset arithmetic on
+ * handles follows the address/offset rules:
+ *
+ * handle - handle => offset
+ * handle + offset => handle
+ *
+ * Allocation bumps a pointer, reset() releases all allocations at once.
+ * Destructors of objects in the arena are not run. Handle value 0 is
+ * reserved as the null handle, which allocation returns on exhaustion.
+ * The capacity is at most the largest value of O, the range of a handle.
+ */
+template< typename O = std::uint32_t, typename Tag = struct arena_tag >
+class arena
+{
+public:
+    typedef O                   underlying_type;
+    typedef address<O,O,Tag>    handle_type;
+    typedef offset<O,Tag,O>     offset_type;
+    typedef std::size_t         size_type;
+
+    static_assert( std::numeric_limits<O>::is_integer && !std::numeric_limits<O>::is_signed,
+        "arena: offset type must be an unsigned integer" );
+
+    // capacity is limited to the range of the handle, see capacity():
+
+    explicit arena( size_type capacity_ )
+        : storage( new unsigned char[ clamped_capacity( capacity_ ) ] )
+        , cap( clamped_capacity( capacity_ ) )
+        , top( reserved() )
+    {}
+
+    // a moved-from arena is empty and has no capacity:
+
+    arena( arena && other ) type_noexcept
+        : storage( std::move( other.storage ) )
+        , cap( other.cap )
+        , top( other.top )
+    {
+        other.cap = 0;
+        other.top = reserved();
+    }
+
+    arena & operator=( arena && other ) type_noexcept
+    {
+        if ( this != &other )
+        {
+            storage = std::move( other.storage );
+            cap     = other.cap;
+            top     = other.top;
+
+            other.cap = 0;
+            other.top = reserved();
+        }
+        return *this;
+    }
+
+    arena( arena const & ) = delete;
+    arena & operator=( arena const & ) = delete;
+
+    // the null handle:
+
+    static type_constexpr handle_type null() type_noexcept
+    {
+        return handle_type( O(0) );
+    }
+
+    // allocate size bytes aligned at align, null() if the arena is exhausted:
+
+    handle_type allocate_bytes( size_type size, size_type align = alignof(std::max_align_t) ) type_noexcept
+    {
+        assert( align > 0 && ( align & ( align - 1 ) ) == 0 && "arena: alignment must be a power of two" );
+        assert( align <= alignof(std::max_align_t) && "arena: over-aligned allocation not supported" );
+
+        size_type const pos = ( top + align - 1 ) & ~( align - 1 );
+
+        if ( pos > cap || size > cap - pos )
+            return null();
+
+        top = pos + size;
+        return handle_type( static_cast<O>( pos ) );
+    }
+
+    // allocate uninitialized storage for count objects of type T:
+
+    template< typename T >
+    handle_type allocate( size_type count = 1 ) type_noexcept
+    {
+        return count > ( cap / sizeof(T) ) ? null() : allocate_bytes( count * sizeof(T), alignof(T) );
+    }
+
+    // release all allocations:
+
+    void reset() type_noexcept
+    {
+        top = reserved();
+    }
+
+    // typed access via a handle:
+
+    template< typename T >
+    T * resolve( handle_type h ) type_noexcept
+    {
+        return h == null() ? nullptr : reinterpret_cast<T *>( storage.get() + h.get() );
+    }
+
+    template< typename T >
+    T const * resolve( handle_type h ) const type_noexcept
+    {
+        return h == null() ? nullptr : reinterpret_cast<T const *>( storage.get() + h.get() );
+    }
+
+    // handle of an object within the arena:
+
+    template< typename T >
+    handle_type to_handle( T const * p ) const type_noexcept
+    {
+        return p == nullptr ? null() : handle_type( static_cast<O>( reinterpret_cast<unsigned char const *>( p ) - storage.get() ) );
+    }
+
+    bool owns( handle_type h ) const type_noexcept
+    {
+        return reserved() <= h.get() && h.get() < top;
+    }
+
+    size_type capacity()  const type_noexcept { return cap; }
+    size_type used()      const type_noexcept { return top - reserved(); }
+    size_type available() const type_noexcept { return top < cap ? cap - top : 0; }
+
+private:
+    static size_type clamped_capacity( size_type n ) type_noexcept
+    {
+        return n < size_type( std::numeric_limits<O>::max() ) ? n : size_type( std::numeric_limits<O>::max() );
+    }
+
+    static type_constexpr size_type reserved() type_noexcept
+    {
+        return 1;
+    }
+
+private:
+    std::unique_ptr<unsigned char[]> storage;
+    size_type cap;
+    size_type top;
+};
+
+}}  // namespace nonstd::types
+
+// make arena available in namespace nonstd:
+
+namespace nonstd {
+
+using types::arena;
+
+} // namespace nonstd
+
+#endif // type_CPP11_OR_GREATER
+
+#endif // NONSTD_TYPE_ARENA_HPP_INCLUDED
@@ -0,0 +1,179 @@
+// Copyright 2018-2022 Martin Moene
+//
+// type-lite, strong types for C++98 and later.
+// For more information see https://github.com/martinmoene/type-lite
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef NONSTD_TYPE_COMPACT_OPTIONAL_HPP_INCLUDED
+#define NONSTD_TYPE_COMPACT_OPTIONAL_HPP_INCLUDED
+
+#include "type.hpp"
+
+#if type_CPP11_OR_GREATER
+
+#include <cassert>
+#include <type_traits>      // std::integral_constant<>
+#include <utility>          // std::forward()
+
+#if type_CPP17_OR_GREATER
+# include <optional>        // std::bad_optional_access
+#else
+# include <stdexcept>       // std::logic_error
+#endif
+
+namespace nonstd { namespace types {
+
+/**
+ * the exception that compact_optional<S>::value() throws when empty:
+ * std::bad_optional_access since C++17, a std::logic_error before.
+ */
+#if type_CPP17_OR_GREATER
+typedef std::bad_optional_access bad_compact_optional_access;
+#else
+class bad_compact_optional_access : public std::logic_error
+{
+public:
+    bad_compact_optional_access()
+        : std::logic_error( "compact_optional: no value" )
+    {}
+};
+#endif
+
+namespace detail {
+
+// the custom default value of a strong type, declaration only:
+
+template< typename T, typename Tag, typename U, U Val >
+std::integral_constant<U, Val> compact_custom_default( type< T, Tag, custom_default_t<U, Val> > const * );
+
+} // namespace detail
+
+/**
+ * the sentinel of strong type S that represents an empty compact_optional<S>:
+ * by default the custom default value of S, such as -1 for
+ *
+ *   typedef numeric<std::int64_t, struct IdTag, custom_default_t<std::int64_t, -1> > Id;
+ *
+ * Specialize it for another sentinel, such as NaN, providing empty() and
+ * is_empty().
+ */
+template< typename S >
+struct compact_sentinel
+{
+    typedef decltype( detail::compact_custom_default( static_cast<S const *>( nullptr ) ) ) value;
+
+    static type_constexpr S empty() { return S( value::value ); }
+
+    static type_constexpr14 bool is_empty( S const & s ) { return s.get() == value::value; }
+};
+
+/**
+ * compact_optional, an optional strong value of the size of S, that uses
+ * the sentinel value of compact_sentinel<S> to represent 'no value'.
+ *
+ * Storing the sentinel value as a value makes it empty; in debug builds
+ * this is asserted, as is access via * and -> to the value of an empty
+ * optional. value() throws bad_compact_optional_access instead.
+ */
+template< typename S, typename Sentinel = compact_sentinel<S> >
+class compact_optional
+{
+public:
+    typedef S value_type;
+
+    type_constexpr compact_optional()
+        : stored( Sentinel::empty() )
+    {}
+
+    type_constexpr14 compact_optional( S const & v )
+        : stored( checked( v ) )
+    {}
+
+    template< typename... Args >
+    type_constexpr14 S & emplace( Args &&... args )
+    {
+        stored = checked( S( std::forward<Args>( args )... ) );
+        return stored;
+    }
+
+    type_constexpr14 void reset() type_noexcept
+    {
+        stored = Sentinel::empty();
+    }
+
+    type_constexpr14 bool has_value() const
+    {
+        return ! Sentinel::is_empty( stored );
+    }
+
+    type_constexpr14 explicit operator bool() const
+    {
+        return has_value();
+    }
+
+    type_constexpr14 S & value()
+    {
+        if ( ! has_value() )
+            throw bad_compact_optional_access();
+
+        return stored;
+    }
+
+    type_constexpr14 S const & value() const
+    {
+        if ( ! has_value() )
+            throw bad_compact_optional_access();
+
+        return stored;
+    }
+
+    type_constexpr14 S       & operator*()       { return assert( has_value() && "compact_optional: no value" ), stored; }
+    type_constexpr14 S const & operator*() const { return assert( has_value() && "compact_optional: no value" ), stored; }
+
+    type_constexpr14 S       * operator->()       { return assert( has_value() && "compact_optional: no value" ), &stored; }
+    type_constexpr14 S const * operator->() const { return assert( has_value() && "compact_optional: no value" ), &stored; }
+
+    type_constexpr14 S value_or( S const & v ) const
+    {
+        return has_value() ? stored : v;
+    }
+
+    // empty optionals are equal, as are optionals with equal values:
+
+    friend type_constexpr14 bool operator==( compact_optional const & x, compact_optional const & y )
+    {
+        return x.has_value() == y.has_value() && ( ! x.has_value() || x.stored.get() == y.stored.get() );
+    }
+
+    friend type_constexpr14 bool operator!=( compact_optional const & x, compact_optional const & y )
+    {
+        return ! ( x == y );
+    }
+
+private:
+    static type_constexpr14 S const & checked( S const & v )
+    {
+        return assert( ! Sentinel::is_empty( v ) && "compact_optional: value is the sentinel" ), v;
+    }
+
+private:
+    S stored;
+};
+
+}}  // namespace nonstd::types
+
+// make compact_optional available in namespace nonstd:
+
+namespace nonstd {
+
+using types::compact_optional;
+using types::compact_sentinel;
+using types::bad_compact_optional_access;
+
+} // namespace nonstd
+
+#endif // type_CPP11_OR_GREATER
+
+#endif // NONSTD_TYPE_COMPACT_OPTIONAL_HPP_INCLUDED
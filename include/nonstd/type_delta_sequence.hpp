@@ -0,0 +1,344 @@
+// Copyright 2018-2022 Martin Moene
+//
+// type-lite, strong types for C++98 and later.
+// For more information see https://github.com/martinmoene/type-lite
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef NONSTD_TYPE_DELTA_SEQUENCE_HPP_INCLUDED
+#define NONSTD_TYPE_DELTA_SEQUENCE_HPP_INCLUDED
+
+#include "type.hpp"
+
+#if type_CPP11_OR_GREATER
+
+#include <cassert>
+#include <cstddef>          // std::size_t, std::ptrdiff_t
+#include <cstdint>          // std::uint64_t, std::uint32_t
+#include <iterator>         // std::forward_iterator_tag
+#include <memory>           // std::shared_ptr<>
+#include <type_traits>      // std::is_integral<>
+#include <vector>
+
+// Non-aliasing pointer qualification (compiler extension):
+
+#ifndef type_restrict
+# if defined(__GNUC__) || defined(__clang__) || type_COMPILER_MSVC_VER >= 1400
+#  define type_restrict  __restrict
+# else
+#  define type_restrict  /*__restrict*/
+# endif
+#endif
+
+namespace nonstd { namespace types {
+
+namespace detail {
+
+// number of bits needed to represent x:
+
+inline unsigned delta_bit_width( std::uint64_t x ) type_noexcept
+{
+    unsigned n = 0;
+    for ( ; x != 0; x >>= 1 )
+        ++n;
+    return n;
+}
+
+// pack n values of width bits each, appending to words:
+
+inline void delta_pack( std::uint64_t const * in, std::size_t n, unsigned width, std::vector<std::uint64_t> & words )
+{
+    std::size_t const first = words.size();
+    words.resize( first + ( n * width + 63 ) / 64, 0 );
+
+    std::uint64_t * out = words.data() + first;
+
+    for ( std::size_t j = 0; j != n; ++j )
+    {
+        std::size_t const bit   = j * width;
+        std::size_t const word  = bit / 64;
+        unsigned    const shift = static_cast<unsigned>( bit % 64 );
+
+        out[word] |= in[j] << shift;
+
+        if ( shift + width > 64 )
+            out[word + 1] |= in[j] >> ( 64 - shift );
+    }
+}
+
+// unpack n values of width bits each; requires one readable word past the data:
+
+inline void delta_unpack( std::uint64_t const * type_restrict in, std::size_t n, unsigned width, std::uint64_t * type_restrict out ) type_noexcept
+{
+    std::uint64_t const mask = width == 64 ? ~std::uint64_t(0) : ( std::uint64_t(1) << width ) - 1;
+
+    // branch-free inner loop without a loop-carried dependency; with AVX2,
+    // GCC 12 at -O3 vectorizes the shifts (vpsrlvq, vpsllvq), the loads of
+    // the words stay scalar:
+
+    for ( std::size_t j = 0; j != n; ++j )
+    {
+        std::uint64_t const bit   = j * width;
+        std::uint64_t const word  = bit >> 6;
+        std::uint64_t const shift = bit & 63;
+
+        out[j] = ( ( in[word] >> shift ) | ( in[word + 1] << 1 << ( 63 - shift ) ) ) & mask;
+    }
+}
+
+} // namespace detail
+
+/**
+ * delta_sequence, compressed append-only sequence of integer-based strong
+ * values, such as timestamps and sequence numbers, that mostly change by
+ * small amounts.
+ *
+ * Values are stored in blocks of block_size values: the first value of a
+ * block (frame of reference), the minimum delta in the block and the
+ * deltas minus that minimum, bit-packed at the width of the largest one.
+ * Random access decodes a single block; iteration decodes block by block
+ * and yields the strong type.
+ */
+template< typename S >
+class delta_sequence
+{
+public:
+    typedef S                               value_type;
+    typedef typename S::underlying_type     underlying_type;
+    typedef std::size_t                     size_type;
+
+    static_assert( std::is_integral<underlying_type>::value && sizeof(underlying_type) <= 8,
+        "delta_sequence: underlying type must be an integer of at most 64 bits" );
+
+    static const size_type block_size = 128;
+
+    class const_iterator;
+
+    delta_sequence()
+        : words( 1, 0 )
+        , count( 0 )
+    {}
+
+    template< typename InputIt >
+    delta_sequence( InputIt first, InputIt last )
+        : words( 1, 0 )
+        , count( 0 )
+    {
+        for ( ; first != last; ++first )
+            push_back( *first );
+    }
+
+    void push_back( value_type const & v )
+    {
+        tail.push_back( static_cast<std::uint64_t>( to_value( v ) ) );
+        ++count;
+
+        if ( tail.size() == block_size )
+            flush();
+    }
+
+    value_type operator[]( size_type pos ) const
+    {
+        assert( pos < count );
+
+        size_type const b = pos / block_size;
+        size_type const j = pos % block_size;
+
+        if ( b == blocks.size() )
+            return make( tail[j] );
+
+        std::uint64_t buf[ block_size ];
+        decode( b, buf );
+        return make( buf[j] );
+    }
+
+    value_type front() const { return (*this)[0]; }
+    value_type back()  const { return (*this)[ count - 1 ]; }
+
+    const_iterator begin() const { return const_iterator( this, 0 ); }
+    const_iterator end()   const { return const_iterator( this, count ); }
+
+    size_type size()  const type_noexcept { return count; }
+    bool      empty() const type_noexcept { return count == 0; }
+
+    // storage used by the values, in bytes:
+
+    size_type memory_bytes() const type_noexcept
+    {
+        return words.size() * sizeof( std::uint64_t ) + blocks.size() * sizeof( block ) + tail.size() * sizeof( std::uint64_t );
+    }
+
+    void clear()
+    {
+        blocks.clear();
+        words.assign( 1, 0 );
+        tail.clear();
+        count = 0;
+    }
+
+    /**
+     * forward iterator, decoding a block at a time into a buffer that copies
+     * of the iterator share until one of them decodes another block, so
+     * that copying an iterator does not copy a decoded block.
+     */
+    class const_iterator
+    {
+    public:
+        typedef std::forward_iterator_tag   iterator_category;
+        typedef S                           value_type;
+        typedef std::ptrdiff_t              difference_type;
+        typedef void                        pointer;
+        typedef S                           reference;
+
+        const_iterator()
+            : seq( nullptr ), pos( 0 )
+        {}
+
+        value_type operator*() const
+        {
+            size_type const b = pos / block_size;
+
+            if ( b == seq->blocks.size() )
+                return make( seq->tail[ pos % block_size ] );
+
+            if ( ! cache || cache->index != b )
+            {
+                // decode into a buffer of our own, if shared with a copy:
+
+                if ( ! cache || cache.use_count() > 1 )
+                    cache = std::make_shared<decoded_block>();
+
+                seq->decode( b, cache->values );
+                cache->index = b;
+            }
+            return make( cache->values[ pos % block_size ] );
+        }
+
+        const_iterator & operator++() { ++pos; return *this; }
+        const_iterator   operator++( int ) { const_iterator tmp( *this ); ++pos; return tmp; }
+
+        friend bool operator==( const_iterator const & x, const_iterator const & y ) { return x.pos == y.pos; }
+        friend bool operator!=( const_iterator const & x, const_iterator const & y ) { return x.pos != y.pos; }
+
+    private:
+        friend class delta_sequence;
+
+        const_iterator( delta_sequence const * seq_, size_type pos_ )
+            : seq( seq_ ), pos( pos_ )
+        {}
+
+        struct decoded_block
+        {
+            size_type     index;
+            std::uint64_t values[ block_size ];
+        };
+
+        delta_sequence const * seq;
+        size_type pos;
+        mutable std::shared_ptr<decoded_block> cache;
+    };
+
+private:
+    struct block
+    {
+        std::uint64_t base;         // first value
+        std::uint64_t min_delta;    // frame of reference for the deltas
+        std::uint32_t word;         // first word of packed deltas
+        std::uint32_t width;        // bits per packed delta
+    };
+
+    static value_type make( std::uint64_t v )
+    {
+        return value_type( static_cast<underlying_type>( v ) );
+    }
+
+    // compress the tail into a block:
+
+    void flush()
+    {
+        size_type const n = tail.size();
+
+        std::uint64_t deltas[ block_size ];
+        deltas[0] = 0;
+
+        // deltas modulo 2^64, their minimum taken as signed:
+
+        for ( size_type j = 1; j < n; ++j )
+            deltas[j] = tail[j] - tail[j - 1];
+
+        std::uint64_t min_delta = n > 1 ? deltas[1] : 0;
+
+        for ( size_type j = 2; j < n; ++j )
+        {
+            if ( static_cast<std::int64_t>( deltas[j] ) < static_cast<std::int64_t>( min_delta ) )
+                min_delta = deltas[j];
+        }
+
+        std::uint64_t max_packed = 0;
+        for ( size_type j = 1; j < n; ++j )
+        {
+            deltas[j] -= min_delta;
+            max_packed = deltas[j] > max_packed ? deltas[j] : max_packed;
+        }
+
+        block blk;
+        blk.base      = tail[0];
+        blk.min_delta = min_delta;
+        blk.width     = detail::delta_bit_width( max_packed );
+        blk.word      = static_cast<std::uint32_t>( words.size() - 1 );
+
+        // keep one readable word past the packed data for delta_unpack():
+
+        words.pop_back();
+        detail::delta_pack( deltas + 1, n - 1, blk.width, words );
+        words.push_back( 0 );
+
+        blocks.push_back( blk );
+        tail.clear();
+    }
+
+    // decode block b into out[0..block_size):
+
+    void decode( size_type b, std::uint64_t * out ) const type_noexcept
+    {
+        block const & blk = blocks[b];
+
+        out[0] = blk.base;
+
+        if ( blk.width == 0 )
+        {
+            for ( size_type j = 1; j < block_size; ++j )
+                out[j] = out[j - 1] + blk.min_delta;
+            return;
+        }
+
+        detail::delta_unpack( &words[ blk.word ], block_size - 1, blk.width, out + 1 );
+
+        for ( size_type j = 1; j < block_size; ++j )
+            out[j] += out[j - 1] + blk.min_delta;
+    }
+
+private:
+    std::vector<block>          blocks;
+    std::vector<std::uint64_t>  words;
+    std::vector<std::uint64_t>  tail;
+    size_type                   count;
+};
+
+template< typename S >
+const typename delta_sequence<S>::size_type delta_sequence<S>::block_size;
+
+}}  // namespace nonstd::types
+
+// make delta_sequence available in namespace nonstd:
+
+namespace nonstd {
+
+using types::delta_sequence;
+
+} // namespace nonstd
+
+#endif // type_CPP11_OR_GREATER
+
+#endif // NONSTD_TYPE_DELTA_SEQUENCE_HPP_INCLUDED
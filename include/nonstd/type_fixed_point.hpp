@@ -0,0 +1,357 @@
+// Copyright 2018-2022 Martin Moene
+//
+// type-lite, strong types for C++98 and later.
+// For more information see https://github.com/martinmoene/type-lite
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef NONSTD_TYPE_FIXED_POINT_HPP_INCLUDED
+#define NONSTD_TYPE_FIXED_POINT_HPP_INCLUDED
+
+#include "type.hpp"
+
+#if type_CPP11_OR_GREATER
+
+#include <cstdint>          // std::uint64_t, std::uint32_t
+#include <limits>
+#include <type_traits>      // std::is_integral<>, std::is_floating_point<>, std::make_unsigned<>
+
+// Compiler support for 128-bit integers:
+
+#if defined( __SIZEOF_INT128__ )
+# define type_HAVE_INT128  1
+#else
+# define type_HAVE_INT128  0
+#endif
+
+// Use 128-bit integers for the intermediates of 64-bit fixed_point, 0: portable code:
+
+#ifndef  type_CONFIG_FIXED_POINT_INT128
+# define type_CONFIG_FIXED_POINT_INT128  type_HAVE_INT128
+#endif
+
+#if type_CONFIG_FIXED_POINT_INT128 && ! type_HAVE_INT128
+# error type-lite: type_CONFIG_FIXED_POINT_INT128 requires compiler support for __int128
+#endif
+
+namespace nonstd { namespace types {
+
+/**
+ * rounding of fixed_point results: whether to increment the magnitude q of
+ * a result with remainder r of divisor d, given the sign of the result.
+ */
+struct round_toward_zero_t
+{
+    template< typename V >
+    static type_constexpr bool increment( bool /*negative*/, V /*r*/, V /*d*/ ) { return false; }
+};
+
+/**
+ * round toward negative infinity.
+ */
+struct round_down_t
+{
+    template< typename V >
+    static type_constexpr bool increment( bool negative, V r, V /*d*/ ) { return negative && r != V(0); }
+};
+
+/**
+ * round toward positive infinity.
+ */
+struct round_up_t
+{
+    template< typename V >
+    static type_constexpr bool increment( bool negative, V r, V /*d*/ ) { return ! negative && r != V(0); }
+};
+
+/**
+ * round to nearest, halfway away from zero.
+ */
+struct round_nearest_t
+{
+    template< typename V >
+    static type_constexpr bool increment( bool /*negative*/, V r, V d ) { return r >= d - r; }
+};
+
+namespace detail {
+
+// unsigned integer of twice the width of U, with the operations fixed_point needs:
+
+template< typename U, bool Wide = ( sizeof(U) > sizeof(std::uint32_t) ) >
+struct fixed_wide
+{
+    typedef std::uint64_t type;
+
+    static type_constexpr type mul( U a, U b ) { return type(a) * type(b); }
+    static type_constexpr type shl( U a, int n ) { return type(a) << n; }
+
+    static type_constexpr U shr( type w, int n ) { return static_cast<U>( w >> n ); }
+    static type_constexpr U low( type w, int n ) { return static_cast<U>( w & ( ( type(1) << n ) - 1 ) ); }
+
+    static type_constexpr14 U divmod( type w, U d, U & r ) { return r = static_cast<U>( w % d ), static_cast<U>( w / d ); }
+};
+
+#if type_CONFIG_FIXED_POINT_INT128
+
+template< typename U >
+struct fixed_wide< U, true >
+{
+    __extension__ typedef unsigned __int128 type;
+
+    static type_constexpr type mul( U a, U b ) { return type(a) * type(b); }
+    static type_constexpr type shl( U a, int n ) { return type(a) << n; }
+
+    static type_constexpr U shr( type w, int n ) { return static_cast<U>( w >> n ); }
+    static type_constexpr U low( type w, int n ) { return static_cast<U>( w & ( ( type(1) << n ) - 1 ) ); }
+
+    static type_constexpr14 U divmod( type w, U d, U & r ) { return r = static_cast<U>( w % d ), static_cast<U>( w / d ); }
+};
+
+#else // type_CONFIG_FIXED_POINT_INT128
+
+template< typename U >
+struct fixed_wide< U, true >
+{
+    struct type { std::uint64_t hi, lo; };
+
+    static type_constexpr14 type mul( U a, U b )
+    {
+        std::uint64_t const a_lo = a & 0xFFFFFFFFu, a_hi = a >> 32;
+        std::uint64_t const b_lo = b & 0xFFFFFFFFu, b_hi = b >> 32;
+
+        std::uint64_t const ll = a_lo * b_lo, lh = a_lo * b_hi, hl = a_hi * b_lo, hh = a_hi * b_hi;
+        std::uint64_t const mid = ( ll >> 32 ) + ( lh & 0xFFFFFFFFu ) + ( hl & 0xFFFFFFFFu );
+
+        type w = { hh + ( lh >> 32 ) + ( hl >> 32 ) + ( mid >> 32 ), ( mid << 32 ) | ( ll & 0xFFFFFFFFu ) };
+        return w;
+    }
+
+    static type_constexpr14 type shl( U a, int n )
+    {
+        type w = { n == 0 ? 0 : std::uint64_t(a) >> ( 64 - n ), std::uint64_t(a) << n };
+        return w;
+    }
+
+    static type_constexpr U shr( type w, int n ) { return static_cast<U>( n == 0 ? w.lo : ( w.lo >> n ) | ( w.hi << ( 64 - n ) ) ); }
+    static type_constexpr U low( type w, int n ) { return static_cast<U>( w.lo & ( ( std::uint64_t(1) << n ) - 1 ) ); }
+
+    // long division, quotient modulo 2^64:
+
+    static type_constexpr14 U divmod( type w, U d, U & r )
+    {
+        std::uint64_t q = 0, rem = 0;
+
+        for ( int i = 127; i >= 0; --i )
+        {
+            bool const carry = ( rem >> 63 ) != 0;
+            rem = ( rem << 1 ) | ( ( ( i >= 64 ? w.hi >> ( i - 64 ) : w.lo >> i ) ) & 1u );
+            q <<= 1;
+
+            if ( carry || rem >= d )
+            {
+                rem -= d;
+                q |= 1u;
+            }
+        }
+        return r = static_cast<U>( rem ), static_cast<U>( q );
+    }
+};
+
+#endif // type_CONFIG_FIXED_POINT_INT128
+
+// sign and magnitude of integers, without comparing unsigned values to 0:
+
+template< typename Int >
+type_constexpr bool fixed_negative( Int v, std::true_type /*signed*/ ) { return v < Int(0); }
+
+template< typename Int >
+type_constexpr bool fixed_negative( Int, std::false_type /*signed*/ ) { return false; }
+
+template< typename Int >
+type_constexpr bool fixed_negative( Int v ) { return fixed_negative( v, std::is_signed<Int>() ); }
+
+template< typename Int >
+type_constexpr typename std::make_unsigned<Int>::type fixed_magnitude( Int v )
+{
+    typedef typename std::make_unsigned<Int>::type U;
+    return fixed_negative( v ) ? static_cast<U>( U(0) - static_cast<U>( v ) ) : static_cast<U>( v );
+}
+
+template< typename Int >
+type_constexpr Int fixed_signed( bool negative, typename std::make_unsigned<Int>::type q )
+{
+    typedef typename std::make_unsigned<Int>::type U;
+    return static_cast<Int>( negative ? static_cast<U>( U(0) - q ) : q );
+}
+
+} // namespace detail
+
+/**
+ * fixed_point, binary fixed-point number with FracBits fraction bits stored
+ * in integer Int, with the operations of numeric and the scaling of quantity,
+ * for example for a price in 1/65536 units:
+ *
+ *   typedef fixed_point<std::int64_t, 16, struct PriceTag> Price;
+ *
+ * Multiplication and division use intermediates of twice the width of Int,
+ * 128 bits for 64-bit Int, and round their result according to Round.
+ * Conversion from floating point rounds likewise. As with numeric, results
+ * that do not fit Int overflow.
+ */
+template< typename Int, int FracBits, typename Tag, typename Round = round_nearest_t >
+struct fixed_point : type< Int, Tag, Int >
+{
+    static_assert( std::is_integral<Int>::value, "fixed_point: underlying type must be an integer type" );
+    static_assert( FracBits >= 0 && FracBits < std::numeric_limits<Int>::digits, "fixed_point: fraction bits must be in [0..digits of Int)" );
+
+    typedef Int   raw_type;
+    typedef Round rounding;
+    typedef type< Int, Tag, Int > base_type;
+    typedef typename std::make_unsigned<Int>::type unsigned_type;
+    typedef detail::fixed_wide<unsigned_type> wide;
+
+    static type_constexpr int fraction_bits() { return FracBits; }
+
+    // the raw value of 1:
+
+    static type_constexpr Int one() { return static_cast<Int>( Int(1) << FracBits ); }
+
+    type_constexpr fixed_point()
+        : base_type()
+    {}
+
+    // from floating point, rounded:
+
+    template< typename F type_REQUIRES_T( std::is_floating_point<F>::value ) >
+    type_constexpr explicit fixed_point( F v )
+        : base_type( from_floating( v < F(0), v < F(0) ? -v * F( one() ) : v * F( one() ) ) )
+    {}
+
+    // from the raw representation, or from an integral value:
+
+    static type_constexpr fixed_point from_raw( Int v )
+    {
+        return fixed_point( raw_tag(), v );
+    }
+
+    static type_constexpr fixed_point from_integer( Int v )
+    {
+        return fixed_point( raw_tag(), static_cast<Int>( v * one() ) );
+    }
+
+    type_constexpr Int raw() const
+    {
+        return this->get();
+    }
+
+    // to floating point:
+
+    template< typename F type_REQUIRES_T( std::is_floating_point<F>::value ) >
+    type_constexpr explicit operator F() const
+    {
+        return F( this->get() ) / F( one() );
+    }
+
+    friend type_constexpr bool operator==( fixed_point const & x, fixed_point const & y ) { return x.get() == y.get(); }
+    friend type_constexpr bool operator!=( fixed_point const & x, fixed_point const & y ) { return x.get() != y.get(); }
+    friend type_constexpr bool operator< ( fixed_point const & x, fixed_point const & y ) { return x.get() <  y.get(); }
+    friend type_constexpr bool operator<=( fixed_point const & x, fixed_point const & y ) { return x.get() <= y.get(); }
+    friend type_constexpr bool operator> ( fixed_point const & x, fixed_point const & y ) { return x.get() >  y.get(); }
+    friend type_constexpr bool operator>=( fixed_point const & x, fixed_point const & y ) { return x.get() >= y.get(); }
+
+    type_constexpr14 fixed_point operator+() const { return *this; }
+    type_constexpr14 fixed_point operator-() const { return from_raw( static_cast<Int>( -this->get() ) ); }
+
+    type_constexpr14 fixed_point & operator++() { this->get() = static_cast<Int>( this->get() + one() ); return *this; }
+    type_constexpr14 fixed_point & operator--() { this->get() = static_cast<Int>( this->get() - one() ); return *this; }
+
+    type_constexpr14 fixed_point   operator++( int ) { fixed_point tmp( *this ); ++*this; return tmp; }
+    type_constexpr14 fixed_point   operator--( int ) { fixed_point tmp( *this ); --*this; return tmp; }
+
+    type_constexpr14 fixed_point & operator+=( fixed_point const & y ) { this->get() = static_cast<Int>( this->get() + y.get() ); return *this; }
+    type_constexpr14 fixed_point & operator-=( fixed_point const & y ) { this->get() = static_cast<Int>( this->get() - y.get() ); return *this; }
+    type_constexpr14 fixed_point & operator%=( fixed_point const & y ) { this->get() = static_cast<Int>( this->get() % y.get() ); return *this; }
+
+    // x * y, x / y with a double-width intermediate, rounded:
+
+    type_constexpr14 fixed_point & operator*=( fixed_point const & y )
+    {
+        bool const negative = detail::fixed_negative( this->get() ) != detail::fixed_negative( y.get() );
+        typename wide::type const w = wide::mul( detail::fixed_magnitude( this->get() ), detail::fixed_magnitude( y.get() ) );
+
+        this->get() = rounded( negative, wide::shr( w, FracBits ), wide::low( w, FracBits ), static_cast<unsigned_type>( one() ) );
+        return *this;
+    }
+
+    type_constexpr14 fixed_point & operator/=( fixed_point const & y )
+    {
+        bool const negative = detail::fixed_negative( this->get() ) != detail::fixed_negative( y.get() );
+        unsigned_type const d = detail::fixed_magnitude( y.get() );
+        unsigned_type r = 0;
+        unsigned_type const q = wide::divmod( wide::shl( detail::fixed_magnitude( this->get() ), FracBits ), d, r );
+
+        this->get() = rounded( negative, q, r, d );
+        return *this;
+    }
+
+    // scaling by an integer, x * n, n * x, x / n:
+
+    type_constexpr14 fixed_point & operator*=( Int n ) { this->get() = static_cast<Int>( this->get() * n ); return *this; }
+
+    type_constexpr14 fixed_point & operator/=( Int n )
+    {
+        bool const negative = detail::fixed_negative( this->get() ) != detail::fixed_negative( n );
+        unsigned_type const x = detail::fixed_magnitude( this->get() ), d = detail::fixed_magnitude( n );
+
+        this->get() = rounded( negative, static_cast<unsigned_type>( x / d ), static_cast<unsigned_type>( x % d ), d );
+        return *this;
+    }
+
+    friend type_constexpr14 fixed_point operator+( fixed_point x, fixed_point const & y ) { type_COUNT_OPERATION( fixed_point, op_add ); return x += y; }
+    friend type_constexpr14 fixed_point operator-( fixed_point x, fixed_point const & y ) { type_COUNT_OPERATION( fixed_point, op_sub ); return x -= y; }
+    friend type_constexpr14 fixed_point operator*( fixed_point x, fixed_point const & y ) { type_COUNT_OPERATION( fixed_point, op_mul ); return x *= y; }
+    friend type_constexpr14 fixed_point operator/( fixed_point x, fixed_point const & y ) { type_COUNT_OPERATION( fixed_point, op_div ); return x /= y; }
+    friend type_constexpr14 fixed_point operator%( fixed_point x, fixed_point const & y ) { type_COUNT_OPERATION( fixed_point, op_mod ); return x %= y; }
+
+    friend type_constexpr14 fixed_point operator*( fixed_point x, Int n ) { type_COUNT_OPERATION( fixed_point, op_mul ); return x *= n; }
+    friend type_constexpr14 fixed_point operator*( Int n, fixed_point x ) { type_COUNT_OPERATION( fixed_point, op_mul ); return x *= n; }
+    friend type_constexpr14 fixed_point operator/( fixed_point x, Int n ) { type_COUNT_OPERATION( fixed_point, op_div ); return x /= n; }
+
+private:
+    struct raw_tag{};
+
+    type_constexpr fixed_point( raw_tag, Int v )
+        : base_type( v )
+    {}
+
+    static type_constexpr Int rounded( bool negative, unsigned_type q, unsigned_type r, unsigned_type d )
+    {
+        return detail::fixed_signed<Int>( negative, static_cast<unsigned_type>( q + ( Round::increment( negative, r, d ) ? 1u : 0u ) ) );
+    }
+
+    template< typename F >
+    static type_constexpr Int from_floating( bool negative, F m )
+    {
+        return detail::fixed_signed<Int>( negative, static_cast<unsigned_type>( static_cast<unsigned_type>( m )
+            + ( Round::increment( negative, m - F( static_cast<unsigned_type>( m ) ), F(1) ) ? 1u : 0u ) ) );
+    }
+};
+
+}}  // namespace nonstd::types
+
+// make fixed_point and its rounding available in namespace nonstd:
+
+namespace nonstd {
+
+using types::fixed_point;
+using types::round_toward_zero_t;
+using types::round_down_t;
+using types::round_up_t;
+using types::round_nearest_t;
+
+} // namespace nonstd
+
+#endif // type_CPP11_OR_GREATER
+
+#endif // NONSTD_TYPE_FIXED_POINT_HPP_INCLUDED
@@ -0,0 +1,67 @@
+// Copyright 2018-2022 Martin Moene
+//
+// type-lite, strong types for C++98 and later.
+// For more information see https://github.com/martinmoene/type-lite
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Forward declarations of the strong type families and default policies.
+//
+// This header includes no standard library headers. It suffices to name a
+// strong type, such as numeric<int,Tag>, in a declaration; include
+// nonstd/type.hpp to define, construct or operate on strong values.
+
+#ifndef NONSTD_TYPE_FWD_HPP_INCLUDED
+#define NONSTD_TYPE_FWD_HPP_INCLUDED
+
+namespace nonstd { namespace types {
+
+/**
+ * disallow default construction.
+ */
+struct no_default_t{};
+
+/**
+ * custom default value
+ */
+template<typename T, T Val> struct custom_default_t{};
+
+// the families, see nonstd/type.hpp:
+
+template< typename T, typename D = T >                          struct data;
+template< typename T, typename Tag, typename D = T >            struct type;
+template< typename Tag, typename D = bool >                     struct boolean;
+template< typename T, typename Tag, typename D = T >            struct logical;
+template< typename T, typename Tag, typename D = T >            struct equality;
+template< typename T, typename Tag, typename D = T >            struct bits;
+template< typename T, typename Tag, typename D = T >            struct ordered;
+template< typename T, typename Tag, typename D = T >            struct numeric;
+template< typename T, typename Tag, typename D = T >            struct quantity;
+template< typename T, typename Tag, typename D = T >            struct offset;
+template< typename T, typename O, typename Tag, typename D = T > struct address;
+
+}}  // namespace nonstd::types
+
+// make the declarations available in namespace nonstd:
+
+namespace nonstd {
+
+using types::no_default_t;
+using types::custom_default_t;
+
+using types::type;
+using types::bits;
+using types::boolean;
+using types::logical;
+using types::equality;
+using types::ordered;
+using types::numeric;
+using types::quantity;
+
+using types::offset;
+using types::address;
+
+} // namespace nonstd
+
+#endif // NONSTD_TYPE_FWD_HPP_INCLUDED
@@ -0,0 +1,83 @@
+// Copyright 2018-2022 Martin Moene
+//
+// type-lite, strong types for C++98 and later.
+// For more information see https://github.com/martinmoene/type-lite
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef NONSTD_TYPE_HANDLE_HPP_INCLUDED
+#define NONSTD_TYPE_HANDLE_HPP_INCLUDED
+
+#include "type.hpp"
+
+#if type_CPP11_OR_GREATER
+
+#include <cassert>
+#include <cstdint>          // std::uint32_t
+#include <limits>
+
+namespace nonstd { namespace types {
+
+/**
+ * handle, generational handle: an index in the low IndexBits bits and a
+ * generation in the remaining bits of unsigned integer W, for example:
+ *
+ *   typedef handle<struct EntityTag> Entity;   // 20 index bits, 12 generation bits
+ *
+ * Handles are equality-comparable. Generation 0 is never issued, so that a
+ * default-constructed handle is null. The tag keeps handles of different
+ * pools apart.
+ */
+template< typename Tag, int IndexBits = 20, typename W = std::uint32_t >
+struct handle : equality< W, Tag >
+{
+    static_assert( std::numeric_limits<W>::is_integer && ! std::numeric_limits<W>::is_signed, "handle: word type must be an unsigned integer type" );
+    static_assert( IndexBits > 0 && IndexBits < std::numeric_limits<W>::digits, "handle: index bits must be in [1..digits of W)" );
+
+    typedef W word_type;
+
+    static type_constexpr int index_bits()      { return IndexBits; }
+    static type_constexpr int generation_bits() { return std::numeric_limits<W>::digits - IndexBits; }
+
+    static type_constexpr W max_index()      { return static_cast<W>( ( W(1) << IndexBits ) - 1u ); }
+    static type_constexpr W max_generation() { return static_cast<W>( W(~W(0)) >> IndexBits ); }
+
+    // null handle:
+
+    type_constexpr handle()
+        : equality<W,Tag>()
+    {}
+
+    type_constexpr handle( W index, W generation )
+        : equality<W,Tag>( checked( index, generation ) )
+    {}
+
+    type_constexpr14 W index()      const { return static_cast<W>( this->get() & max_index() ); }
+    type_constexpr14 W generation() const { return static_cast<W>( this->get() >> IndexBits ); }
+
+    type_constexpr14 bool is_null() const { return generation() == 0u; }
+
+private:
+    // the packed handle, or the null handle if index or generation is out of range:
+
+    static type_constexpr W checked( W index, W generation )
+    {
+        return assert( index <= max_index() && generation <= max_generation() && "handle: index or generation out of range" ),
+            index <= max_index() && generation <= max_generation() ? static_cast<W>( static_cast<W>( generation << IndexBits ) | index ) : W(0);
+    }
+};
+
+}}  // namespace nonstd::types
+
+// make handle available in namespace nonstd:
+
+namespace nonstd {
+
+using types::handle;
+
+} // namespace nonstd
+
+#endif // type_CPP11_OR_GREATER
+
+#endif // NONSTD_TYPE_HANDLE_HPP_INCLUDED
@@ -0,0 +1,57 @@
+// Copyright 2018-2022 Martin Moene
+//
+// type-lite, strong types for C++98 and later.
+// For more information see https://github.com/martinmoene/type-lite
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// std::hash<> specialization and make_hash() for strong types (C++11).
+//
+// Included by nonstd/type.hpp, unless type_CONFIG_INCLUDE_STD_HASH is 0.
+
+#ifndef NONSTD_TYPE_HASH_HPP_INCLUDED
+#define NONSTD_TYPE_HASH_HPP_INCLUDED
+
+#include "type.hpp"
+
+#if type_HAVE_STD_HASH
+
+# include <cstddef>        // std::size_t
+# include <functional>     // std::hash<>
+
+namespace std {
+
+template< typename T, typename Tag, typename D >
+struct hash< ::nonstd::types::type<T,Tag,D> >
+{
+public:
+    std::size_t operator()( ::nonstd::types::type<T,Tag,D> const & v ) const type_noexcept
+    {
+        return std::hash<T>()( v.get() );
+    }
+};
+
+}  // namespace std
+
+namespace nonstd { namespace types {
+
+template< typename T, typename Tag, typename D >
+std::size_t make_hash( type<T,Tag,D> const & v ) type_noexcept
+{
+    return std::hash<::nonstd::types::type<T,Tag,D> >()( v );
+}
+
+}} // namespace nonstd::types
+
+// make make_hash() available in namespace nonstd:
+
+namespace nonstd {
+
+using types::make_hash;
+
+} // namespace nonstd
+
+#endif // type_HAVE_STD_HASH
+
+#endif // NONSTD_TYPE_HASH_HPP_INCLUDED
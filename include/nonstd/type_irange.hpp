@@ -0,0 +1,159 @@
+// Copyright 2018-2022 Martin Moene
+//
+// type-lite, strong types for C++98 and later.
+// For more information see https://github.com/martinmoene/type-lite
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef NONSTD_TYPE_IRANGE_HPP_INCLUDED
+#define NONSTD_TYPE_IRANGE_HPP_INCLUDED
+
+#include "type.hpp"
+
+#include <cstddef>          // std::ptrdiff_t, std::size_t
+#include <iterator>         // std::random_access_iterator_tag
+
+namespace nonstd { namespace types {
+
+/**
+ * iterator over a half-open range of strong indices.
+ *
+ * Iterates over the underlying value and yields a strong index on
+ * dereference, so that loop control is on the raw integer.
+ */
+template< typename Index >
+class irange_iterator
+{
+public:
+    typedef typename Index::underlying_type underlying_type;
+
+    typedef std::random_access_iterator_tag iterator_category;
+    typedef Index                           value_type;
+    typedef std::ptrdiff_t                  difference_type;
+    typedef void                            pointer;
+    typedef Index                           reference;
+
+    type_constexpr irange_iterator()
+        : value()
+    {}
+
+    type_constexpr explicit irange_iterator( underlying_type v )
+        : value( v )
+    {}
+
+    type_constexpr Index operator*() const { return Index( value ); }
+    type_constexpr Index operator[]( difference_type n ) const { return Index( static_cast<underlying_type>( value + n ) ); }
+
+    type_constexpr14 irange_iterator & operator++() { ++value; return *this; }
+    type_constexpr14 irange_iterator & operator--() { --value; return *this; }
+
+    type_constexpr14 irange_iterator   operator++( int ) { irange_iterator tmp(*this); ++value; return tmp; }
+    type_constexpr14 irange_iterator   operator--( int ) { irange_iterator tmp(*this); --value; return tmp; }
+
+    type_constexpr14 irange_iterator & operator+=( difference_type n ) { value = static_cast<underlying_type>( value + n ); return *this; }
+    type_constexpr14 irange_iterator & operator-=( difference_type n ) { value = static_cast<underlying_type>( value - n ); return *this; }
+
+    friend type_constexpr14 irange_iterator operator+( irange_iterator x, difference_type n ) { return x += n; }
+    friend type_constexpr14 irange_iterator operator+( difference_type n, irange_iterator x ) { return x += n; }
+    friend type_constexpr14 irange_iterator operator-( irange_iterator x, difference_type n ) { return x -= n; }
+
+    friend type_constexpr difference_type operator-( irange_iterator const & x, irange_iterator const & y )
+    {
+        return static_cast<difference_type>( x.value ) - static_cast<difference_type>( y.value );
+    }
+
+    friend type_constexpr bool operator==( irange_iterator const & x, irange_iterator const & y ) { return x.value == y.value; }
+    friend type_constexpr bool operator!=( irange_iterator const & x, irange_iterator const & y ) { return x.value != y.value; }
+    friend type_constexpr bool operator< ( irange_iterator const & x, irange_iterator const & y ) { return x.value <  y.value; }
+    friend type_constexpr bool operator> ( irange_iterator const & x, irange_iterator const & y ) { return y.value <  x.value; }
+    friend type_constexpr bool operator<=( irange_iterator const & x, irange_iterator const & y ) { return !( y.value < x.value ); }
+    friend type_constexpr bool operator>=( irange_iterator const & x, irange_iterator const & y ) { return !( x.value < y.value ); }
+
+private:
+    underlying_type value;
+};
+
+/**
+ * irange, lazy half-open range [first..last) of strong indices.
+ *
+ * An empty range results when last precedes first.
+ */
+template< typename Index >
+class irange
+{
+public:
+    typedef typename Index::underlying_type underlying_type;
+
+    typedef Index                    value_type;
+    typedef std::size_t              size_type;
+    typedef std::ptrdiff_t           difference_type;
+    typedef irange_iterator<Index>   iterator;
+    typedef irange_iterator<Index>   const_iterator;
+
+    type_constexpr explicit irange( Index const & last_ )
+        : first_value( underlying_type() )
+        , last_value ( clamp( underlying_type(), last_.get() ) )
+    {}
+
+    type_constexpr irange( Index const & first_, Index const & last_ )
+        : first_value( first_.get() )
+        , last_value ( clamp( first_.get(), last_.get() ) )
+    {}
+
+    type_constexpr iterator begin() const { return iterator( first_value ); }
+    type_constexpr iterator end()   const { return iterator( last_value  ); }
+
+    type_constexpr Index front() const { return Index( first_value ); }
+    type_constexpr Index back()  const { return Index( static_cast<underlying_type>( last_value - 1 ) ); }
+
+    type_constexpr bool      empty() const { return first_value == last_value; }
+    type_constexpr size_type size()  const { return static_cast<size_type>( end() - begin() ); }
+
+    type_constexpr Index operator[]( size_type n ) const
+    {
+        return Index( static_cast<underlying_type>( first_value + static_cast<difference_type>( n ) ) );
+    }
+
+private:
+    static type_constexpr underlying_type clamp( underlying_type const & lo, underlying_type const & v )
+    {
+        return v < lo ? lo : v;
+    }
+
+private:
+    underlying_type first_value;
+    underlying_type last_value;
+};
+
+/**
+ * create an irange [0..last).
+ */
+template< typename Index >
+inline type_constexpr irange<Index> make_irange( Index const & last )
+{
+    return irange<Index>( last );
+}
+
+/**
+ * create an irange [first..last).
+ */
+template< typename Index >
+inline type_constexpr irange<Index> make_irange( Index const & first, Index const & last )
+{
+    return irange<Index>( first, last );
+}
+
+}}  // namespace nonstd::types
+
+// make irange available in namespace nonstd:
+
+namespace nonstd {
+
+using types::irange;
+using types::irange_iterator;
+using types::make_irange;
+
+} // namespace nonstd
+
+#endif // NONSTD_TYPE_IRANGE_HPP_INCLUDED
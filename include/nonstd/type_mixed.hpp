@@ -0,0 +1,248 @@
+// Copyright 2018-2022 Martin Moene
+//
+// type-lite, strong types for C++98 and later.
+// For more information see https://github.com/martinmoene/type-lite
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef NONSTD_TYPE_MIXED_HPP_INCLUDED
+#define NONSTD_TYPE_MIXED_HPP_INCLUDED
+
+#include "type.hpp"
+
+#if type_CPP11_OR_GREATER
+
+#include <cstdint>          // std::int8_t, ...
+#include <limits>           // std::numeric_limits<>
+#include <type_traits>      // std::common_type<>, std::conditional<>, std::is_same<>, std::false_type
+
+namespace nonstd { namespace types {
+
+/**
+ * opt in to mixed arithmetic between numeric, respectively quantity, types
+ * of tag Tag with different underlying types, for example:
+ *
+ *   namespace nonstd { namespace types {
+ *   template<> struct mixed_arithmetic<CountTag> : std::true_type {};
+ *   }}
+ */
+template< typename Tag >
+struct mixed_arithmetic : std::false_type {};
+
+namespace detail {
+
+// the smallest signed integer type of at least Digits value bits, or void:
+
+template< int Digits >
+struct mixed_signed
+{
+    typedef typename std::conditional< Digits <=  7, std::int8_t ,
+            typename std::conditional< Digits <= 15, std::int16_t,
+            typename std::conditional< Digits <= 31, std::int32_t,
+            typename std::conditional< Digits <= 63, std::int64_t, void >::type >::type >::type >::type type;
+};
+
+// the common type of underlying types T1 and T2: std::common_type<>, except
+// for integers of different signedness, where that may be unsigned: the
+// smallest signed type, at least int, that holds the values of both:
+
+template< typename T1, typename T2, bool MixedSign = std::is_integral<T1>::value && std::is_integral<T2>::value && std::is_signed<T1>::value != std::is_signed<T2>::value >
+struct mixed_common
+{
+    typedef typename std::common_type<T1,T2>::type type;
+};
+
+template< typename T1, typename T2 >
+struct mixed_common< T1, T2, true >
+{
+    static type_constexpr int digits =
+        std::numeric_limits<T1>::digits > std::numeric_limits<T2>::digits ? std::numeric_limits<T1>::digits : std::numeric_limits<T2>::digits;
+
+    typedef typename mixed_signed< ( digits < std::numeric_limits<int>::digits ? std::numeric_limits<int>::digits : digits ) >::type type;
+
+    static_assert( ! std::is_void<type>::value, "mixed_result: no signed type holds the values of both underlying types; specialize mixed_result" );
+};
+
+// Family<C,Tag> with C the common type of T1 and T2, if mixed arithmetic is
+// enabled for Tag and T1 and T2 differ:
+
+template< template< typename, typename, typename > class Family, typename T1, typename T2, typename Tag
+    , bool Enable = mixed_arithmetic<Tag>::value && ! std::is_same<T1,T2>::value >
+struct mixed_family {};
+
+template< template< typename, typename, typename > class Family, typename T1, typename T2, typename Tag >
+struct mixed_family< Family, T1, T2, Tag, true >
+{
+    typedef typename mixed_common<T1,T2>::type common;
+    typedef Family< common, Tag, common > type;
+};
+
+} // namespace detail
+
+/**
+ * result type of mixed arithmetic of strong types X and Y: the family of X
+ * and Y with the common type of their underlying types. For integers of
+ * different signedness that is a signed type that holds both ranges, so that
+ * for example numeric<int,Tag>(-1) < numeric<unsigned,Tag>(1); a mix that no
+ * signed type can hold, such as with std::uint64_t, is rejected. Specialize it to
+ * choose another result type, or to enable a single combination.
+ */
+template< typename X, typename Y >
+struct mixed_result {};
+
+template< typename T1, typename T2, typename Tag, typename D1, typename D2 >
+struct mixed_result< numeric<T1,Tag,D1>, numeric<T2,Tag,D2> > : detail::mixed_family< numeric, T1, T2, Tag > {};
+
+template< typename T1, typename T2, typename Tag, typename D1, typename D2 >
+struct mixed_result< quantity<T1,Tag,D1>, quantity<T2,Tag,D2> > : detail::mixed_family< quantity, T1, T2, Tag > {};
+
+namespace detail {
+
+// mixed_result<X,Y>::type if X and Y are both numeric types:
+
+template< typename X, typename Y, typename R = typename mixed_result<X,Y>::type >
+struct mixed_numeric {};
+
+template< typename X, typename Y, typename T, typename Tag, typename D >
+struct mixed_numeric< X, Y, numeric<T,Tag,D> >
+{
+    typedef numeric<T,Tag,D> type;
+};
+
+// underlying value of x as underlying type of R:
+
+template< typename R, typename X >
+type_constexpr typename R::underlying_type mixed_value( X const & x )
+{
+    return static_cast<typename R::underlying_type>( x.get() );
+}
+
+} // namespace detail
+
+// The operands are promoted to the underlying type of the result type at
+// compile time; the only strong object created is the result.
+
+/**
+ * x + y, x - y of mixed numeric or quantity types.
+ */
+template< typename X, typename Y >
+inline type_constexpr14 typename mixed_result<X,Y>::type operator+( X const & x, Y const & y )
+{
+    typedef typename mixed_result<X,Y>::type R;
+    type_COUNT_OPERATION( R, op_add );
+    return R( static_cast<typename R::underlying_type>( detail::mixed_value<R>( x ) + detail::mixed_value<R>( y ) ) );
+}
+
+template< typename X, typename Y >
+inline type_constexpr14 typename mixed_result<X,Y>::type operator-( X const & x, Y const & y )
+{
+    typedef typename mixed_result<X,Y>::type R;
+    type_COUNT_OPERATION( R, op_sub );
+    return R( static_cast<typename R::underlying_type>( detail::mixed_value<R>( x ) - detail::mixed_value<R>( y ) ) );
+}
+
+/**
+ * x * y, x / y, x % y of mixed numeric types.
+ */
+template< typename X, typename Y >
+inline type_constexpr14 typename detail::mixed_numeric<X,Y>::type operator*( X const & x, Y const & y )
+{
+    typedef typename mixed_result<X,Y>::type R;
+    type_COUNT_OPERATION( R, op_mul );
+    return R( static_cast<typename R::underlying_type>( detail::mixed_value<R>( x ) * detail::mixed_value<R>( y ) ) );
+}
+
+template< typename X, typename Y >
+inline type_constexpr14 typename detail::mixed_numeric<X,Y>::type operator/( X const & x, Y const & y )
+{
+    typedef typename mixed_result<X,Y>::type R;
+    type_COUNT_OPERATION( R, op_div );
+    return R( static_cast<typename R::underlying_type>( detail::mixed_value<R>( x ) / detail::mixed_value<R>( y ) ) );
+}
+
+template< typename X, typename Y >
+inline type_constexpr14 typename detail::mixed_numeric<X,Y>::type operator%( X const & x, Y const & y )
+{
+    typedef typename mixed_result<X,Y>::type R;
+    type_COUNT_OPERATION( R, op_mod );
+    return R( static_cast<typename R::underlying_type>( detail::mixed_value<R>( x ) % detail::mixed_value<R>( y ) ) );
+}
+
+/**
+ * x += y, x -= y, if the result type is that of x, i.e. without narrowing.
+ */
+template< typename X, typename Y >
+inline type_constexpr14 type_REQUIRES_R( X &, std::is_same< typename mixed_result<X,Y>::type, X >::value )
+operator+=( X & x, Y const & y )
+{
+    return x.get() += detail::mixed_value<X>( y ), x;
+}
+
+template< typename X, typename Y >
+inline type_constexpr14 type_REQUIRES_R( X &, std::is_same< typename mixed_result<X,Y>::type, X >::value )
+operator-=( X & x, Y const & y )
+{
+    return x.get() -= detail::mixed_value<X>( y ), x;
+}
+
+/**
+ * x == y, x != y, x < y, x <= y, x > y, x >= y of mixed numeric or quantity
+ * types, comparing the underlying values as the result type.
+ */
+template< typename X, typename Y >
+inline type_constexpr type_REQUIRES_R( bool, sizeof( typename mixed_result<X,Y>::type ) > 0 )
+operator==( X const & x, Y const & y )
+{
+    return detail::mixed_value< typename mixed_result<X,Y>::type >( x ) == detail::mixed_value< typename mixed_result<X,Y>::type >( y );
+}
+
+template< typename X, typename Y >
+inline type_constexpr type_REQUIRES_R( bool, sizeof( typename mixed_result<X,Y>::type ) > 0 )
+operator!=( X const & x, Y const & y )
+{
+    return ! ( x == y );
+}
+
+template< typename X, typename Y >
+inline type_constexpr type_REQUIRES_R( bool, sizeof( typename mixed_result<X,Y>::type ) > 0 )
+operator<( X const & x, Y const & y )
+{
+    return detail::mixed_value< typename mixed_result<X,Y>::type >( x ) < detail::mixed_value< typename mixed_result<X,Y>::type >( y );
+}
+
+template< typename X, typename Y >
+inline type_constexpr type_REQUIRES_R( bool, sizeof( typename mixed_result<X,Y>::type ) > 0 )
+operator<=( X const & x, Y const & y )
+{
+    return ! ( y < x );
+}
+
+template< typename X, typename Y >
+inline type_constexpr type_REQUIRES_R( bool, sizeof( typename mixed_result<X,Y>::type ) > 0 )
+operator>( X const & x, Y const & y )
+{
+    return y < x;
+}
+
+template< typename X, typename Y >
+inline type_constexpr type_REQUIRES_R( bool, sizeof( typename mixed_result<X,Y>::type ) > 0 )
+operator>=( X const & x, Y const & y )
+{
+    return ! ( x < y );
+}
+
+}}  // namespace nonstd::types
+
+// make mixed arithmetic available in namespace nonstd:
+
+namespace nonstd {
+
+using types::mixed_arithmetic;
+using types::mixed_result;
+
+} // namespace nonstd
+
+#endif // type_CPP11_OR_GREATER
+
+#endif // NONSTD_TYPE_MIXED_HPP_INCLUDED
@@ -0,0 +1,188 @@
+// Copyright 2018-2022 Martin Moene
+//
+// type-lite, strong types for C++98 and later.
+// For more information see https://github.com/martinmoene/type-lite
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef NONSTD_TYPE_OFFSET_PTR_HPP_INCLUDED
+#define NONSTD_TYPE_OFFSET_PTR_HPP_INCLUDED
+
+#include "type.hpp"
+
+#include <cassert>
+#include <cstddef>          // std::ptrdiff_t, std::size_t
+
+#if type_CPP11_OR_GREATER
+# include <cstdint>         // std::uintptr_t
+#endif
+
+namespace nonstd { namespace types {
+
+namespace detail {
+
+// unsigned integer that holds an address; offset_ptr computes its
+// self-relative distances on addresses, not on pointers, as these
+// point to unrelated objects:
+
+#if type_CPP11_OR_GREATER
+typedef std::uintptr_t  offset_ptr_address;
+#else
+typedef std::size_t     offset_ptr_address;
+#endif
+
+} // namespace detail
+
+/**
+ * offset_ptr, self-relative pointer.
+ *
+ * Stores the distance from its own address to the pointee as an
+ * offset<O,Tag>, so that a structure of offset_ptrs that lives in a
+ * shared or memory-mapped region remains valid when the region is
+ * mapped at a different base address. Dereference costs one addition.
+ *
+ * Copying an offset_ptr recomputes the offset for its new location;
+ * copying the bytes of an enclosing region (mmap, memcpy) keeps the
+ * offsets and thus the relations within that region.
+ *
+ * Offset 1 encodes the null pointer, as an offset_ptr cannot point into
+ * its own storage.
+ *
+ * The reach of an offset_ptr is the range of O: with a narrow O, such as
+ * std::int32_t, the pointee must lie within 2 GiB of the offset_ptr, and
+ * with an unsigned O it must lie above it. Debug builds assert this on
+ * every assignment and on pointer arithmetic.
+ */
+template< typename T, typename Tag, typename O = std::ptrdiff_t >
+class offset_ptr
+{
+private:
+    typedef void ( offset_ptr::*bool_type )() const;
+
+    void this_type_does_not_support_comparisons() const {}
+
+public:
+    typedef T                   element_type;
+    typedef T                   value_type;
+    typedef T *                 pointer;
+    typedef T &                 reference;
+    typedef std::ptrdiff_t      difference_type;
+    typedef offset<O,Tag,O>     offset_type;
+
+    offset_ptr()
+        : off( null_offset() )
+    {}
+
+    offset_ptr( T * p )
+        : off( offset_to( p ) )
+    {}
+
+    offset_ptr( offset_ptr const & other )
+        : off( offset_to( other.get() ) )
+    {}
+
+    offset_ptr & operator=( offset_ptr const & other )
+    {
+        off = offset_to( other.get() );
+        return *this;
+    }
+
+    offset_ptr & operator=( T * p )
+    {
+        off = offset_to( p );
+        return *this;
+    }
+
+    T * get() const
+    {
+        return off == null_offset() ? 0 : reinterpret_cast<T *>( self() + static_cast<address>( off.get() ) );
+    }
+
+    T & operator* () const { return *get(); }
+    T * operator->() const { return  get(); }
+
+    T & operator[]( difference_type n ) const { return get()[n]; }
+
+    // the stored self-relative offset:
+
+    offset_type to_offset() const
+    {
+        return off;
+    }
+
+#if type_HAVE_EXPLICIT_CONVERSION
+    type_explicit operator bool() const
+    {
+        return off != null_offset();
+    }
+#else
+    operator bool_type() const
+    {
+        return off != null_offset() ? &offset_ptr::this_type_does_not_support_comparisons : 0;
+    }
+#endif
+
+    offset_ptr & operator+=( difference_type n ) { off = offset_to( get() + n ); return *this; }
+    offset_ptr & operator-=( difference_type n ) { off = offset_to( get() - n ); return *this; }
+
+    offset_ptr & operator++() { return *this += 1; }
+    offset_ptr & operator--() { return *this -= 1; }
+
+    offset_ptr   operator++( int ) { offset_ptr tmp( *this ); ++*this; return tmp; }
+    offset_ptr   operator--( int ) { offset_ptr tmp( *this ); --*this; return tmp; }
+
+    friend offset_ptr operator+( offset_ptr const & x, difference_type n ) { return offset_ptr( x.get() + n ); }
+    friend offset_ptr operator-( offset_ptr const & x, difference_type n ) { return offset_ptr( x.get() - n ); }
+
+    friend difference_type operator-( offset_ptr const & x, offset_ptr const & y ) { return x.get() - y.get(); }
+
+    friend bool operator==( offset_ptr const & x, offset_ptr const & y ) { return x.get() == y.get(); }
+    friend bool operator!=( offset_ptr const & x, offset_ptr const & y ) { return x.get() != y.get(); }
+    friend bool operator< ( offset_ptr const & x, offset_ptr const & y ) { return x.get() <  y.get(); }
+    friend bool operator> ( offset_ptr const & x, offset_ptr const & y ) { return y.get() <  x.get(); }
+    friend bool operator<=( offset_ptr const & x, offset_ptr const & y ) { return !( y.get() < x.get() ); }
+    friend bool operator>=( offset_ptr const & x, offset_ptr const & y ) { return !( x.get() < y.get() ); }
+
+private:
+    static offset_type null_offset()
+    {
+        return offset_type( O(1) );
+    }
+
+    typedef detail::offset_ptr_address address;
+
+    address self() const
+    {
+        return reinterpret_cast<address>( this );
+    }
+
+    // the distance to p must survive the round trip through O that get() makes:
+
+    offset_type offset_to( T const * p ) const
+    {
+        if ( p == 0 )
+            return null_offset();
+
+        address const distance = reinterpret_cast<address>( p ) - self();
+
+        assert( static_cast<address>( static_cast<O>( distance ) ) == distance && "offset_ptr: pointee out of reach of offset type O" );
+
+        return offset_type( static_cast<O>( distance ) );
+    }
+
+private:
+    offset_type off;
+};
+
+}}  // namespace nonstd::types
+
+// make offset_ptr available in namespace nonstd:
+
+namespace nonstd {
+
+using types::offset_ptr;
+
+} // namespace nonstd
+
+#endif // NONSTD_TYPE_OFFSET_PTR_HPP_INCLUDED
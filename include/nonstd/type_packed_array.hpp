@@ -0,0 +1,359 @@
+// Copyright 2018-2022 Martin Moene
+//
+// type-lite, strong types for C++98 and later.
+// For more information see https://github.com/martinmoene/type-lite
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef NONSTD_TYPE_PACKED_ARRAY_HPP_INCLUDED
+#define NONSTD_TYPE_PACKED_ARRAY_HPP_INCLUDED
+
+#include "type.hpp"
+
+#if type_CPP11_OR_GREATER
+
+#include <algorithm>        // std::fill()
+#include <cassert>
+#include <cstddef>          // std::size_t, std::ptrdiff_t
+#include <cstdint>          // std::uint64_t, std::int64_t
+#include <iterator>         // std::random_access_iterator_tag
+#include <limits>
+#include <type_traits>      // std::is_integral<>, std::is_signed<>
+#include <vector>
+
+// Non-aliasing pointer qualification (compiler extension):
+
+#ifndef type_restrict
+# if defined(__GNUC__) || defined(__clang__) || type_COMPILER_MSVC_VER >= 1400
+#  define type_restrict  __restrict
+# else
+#  define type_restrict  /*__restrict*/
+# endif
+#endif
+
+namespace nonstd { namespace types {
+
+template< typename S, unsigned Bits >
+class packed_array;
+
+/**
+ * iterator over a packed_array, yielding the strong type on dereference.
+ */
+template< typename S, unsigned Bits >
+class packed_array_iterator
+{
+public:
+    typedef std::random_access_iterator_tag iterator_category;
+    typedef S                               value_type;
+    typedef std::ptrdiff_t                  difference_type;
+    typedef void                            pointer;
+    typedef S                               reference;
+
+    packed_array_iterator()
+        : array( nullptr ), pos( 0 )
+    {}
+
+    packed_array_iterator( packed_array<S,Bits> const * array_, std::size_t pos_ )
+        : array( array_ ), pos( pos_ )
+    {}
+
+    S operator*() const { return (*array)[ pos ]; }
+    S operator[]( difference_type n ) const { return (*array)[ pos + static_cast<std::size_t>( n ) ]; }
+
+    packed_array_iterator & operator++() { ++pos; return *this; }
+    packed_array_iterator & operator--() { --pos; return *this; }
+
+    packed_array_iterator   operator++( int ) { packed_array_iterator tmp(*this); ++pos; return tmp; }
+    packed_array_iterator   operator--( int ) { packed_array_iterator tmp(*this); --pos; return tmp; }
+
+    packed_array_iterator & operator+=( difference_type n ) { pos = static_cast<std::size_t>( static_cast<difference_type>( pos ) + n ); return *this; }
+    packed_array_iterator & operator-=( difference_type n ) { pos = static_cast<std::size_t>( static_cast<difference_type>( pos ) - n ); return *this; }
+
+    friend packed_array_iterator operator+( packed_array_iterator x, difference_type n ) { return x += n; }
+    friend packed_array_iterator operator+( difference_type n, packed_array_iterator x ) { return x += n; }
+    friend packed_array_iterator operator-( packed_array_iterator x, difference_type n ) { return x -= n; }
+
+    friend difference_type operator-( packed_array_iterator const & x, packed_array_iterator const & y )
+    {
+        return static_cast<difference_type>( x.pos ) - static_cast<difference_type>( y.pos );
+    }
+
+    friend bool operator==( packed_array_iterator const & x, packed_array_iterator const & y ) { return x.pos == y.pos; }
+    friend bool operator!=( packed_array_iterator const & x, packed_array_iterator const & y ) { return x.pos != y.pos; }
+    friend bool operator< ( packed_array_iterator const & x, packed_array_iterator const & y ) { return x.pos <  y.pos; }
+    friend bool operator> ( packed_array_iterator const & x, packed_array_iterator const & y ) { return y.pos <  x.pos; }
+    friend bool operator<=( packed_array_iterator const & x, packed_array_iterator const & y ) { return !( y.pos < x.pos ); }
+    friend bool operator>=( packed_array_iterator const & x, packed_array_iterator const & y ) { return !( x.pos < y.pos ); }
+
+private:
+    packed_array<S,Bits> const * array;
+    std::size_t pos;
+};
+
+/**
+ * packed_array, array of integer-based strong values of Bits bits each,
+ * packed densely into 64-bit words.
+ *
+ * Signed values are stored in two's complement and sign-extended when
+ * read. Element access yields the strong type, so that its tag and
+ * operators are preserved; unpack() and pack() convert runs of values.
+ */
+template< typename S, unsigned Bits >
+class packed_array
+{
+public:
+    typedef S                                       value_type;
+    typedef typename S::underlying_type             underlying_type;
+    typedef std::size_t                             size_type;
+    typedef std::ptrdiff_t                          difference_type;
+    typedef packed_array_iterator<S,Bits>           iterator;
+    typedef packed_array_iterator<S,Bits>           const_iterator;
+
+    static_assert( std::is_integral<underlying_type>::value,
+        "packed_array: underlying type must be an integer" );
+
+    static_assert( Bits >= 1 && Bits <= 64 && Bits <= std::numeric_limits<underlying_type>::digits + std::is_signed<underlying_type>::value,
+        "packed_array: number of bits must be in [1..width of underlying type]" );
+
+    static const unsigned bits = Bits;
+
+    /**
+     * proxy to an element, converts to and is assignable from the strong type.
+     */
+    class reference
+    {
+    public:
+        reference( reference const & ) = default;
+
+        operator S() const { return array->get( pos ); }
+
+        reference & operator=( S const & v ) { array->set( pos, v ); return *this; }
+        reference & operator=( reference const & other ) { return *this = S( other ); }
+
+    private:
+        friend class packed_array;
+
+        reference( packed_array * array_, size_type pos_ )
+            : array( array_ ), pos( pos_ )
+        {}
+
+        packed_array * array;
+        size_type pos;
+    };
+
+    packed_array()
+        : words( 1, 0 )
+        , count( 0 )
+    {}
+
+    explicit packed_array( size_type n, S const & v = S() )
+        : words( word_count( n ), 0 )
+        , count( n )
+    {
+        for ( size_type i = 0; i != n; ++i )
+            set( i, v );
+    }
+
+    template< typename InputIt >
+    packed_array( InputIt first, InputIt last )
+        : words( 1, 0 )
+        , count( 0 )
+    {
+        for ( ; first != last; ++first )
+            push_back( *first );
+    }
+
+    S operator[]( size_type pos ) const { return get( pos ); }
+    reference operator[]( size_type pos ) { return reference( this, pos ); }
+
+    S get( size_type pos ) const type_noexcept
+    {
+        assert( pos < count );
+
+        std::uint64_t const bit   = std::uint64_t( pos ) * Bits;
+        std::uint64_t const word  = bit >> 6;
+        std::uint64_t const shift = bit & 63;
+
+        return make( ( ( words[ word ] >> shift ) | ( words[ word + 1 ] << 1 << ( 63 - shift ) ) ) & mask() );
+    }
+
+    void set( size_type pos, S const & v ) type_noexcept
+    {
+        assert( pos < count );
+
+        std::uint64_t const raw   = encode( v );
+        std::uint64_t const bit   = std::uint64_t( pos ) * Bits;
+        std::uint64_t const word  = bit >> 6;
+        unsigned      const shift = static_cast<unsigned>( bit & 63 );
+
+        words[ word ] = ( words[ word ] & ~( mask() << shift ) ) | ( raw << shift );
+
+        if ( shift + Bits > 64 )
+        {
+            unsigned const spill = 64 - shift;
+            words[ word + 1 ] = ( words[ word + 1 ] & ~( mask() >> spill ) ) | ( raw >> spill );
+        }
+    }
+
+    /**
+     * convert n values from position pos into out[0..n).
+     *
+     * The loop is branch-free and vectorizes with variable shifts and
+     * gathers (e.g. AVX2).
+     */
+    void unpack( size_type pos, size_type n, S * type_restrict out ) const type_noexcept
+    {
+        assert( pos + n <= count );
+
+        std::uint64_t const * type_restrict in = words.data();
+
+        for ( size_type j = 0; j != n; ++j )
+        {
+            std::uint64_t const bit   = std::uint64_t( pos + j ) * Bits;
+            std::uint64_t const word  = bit >> 6;
+            std::uint64_t const shift = bit & 63;
+
+            out[j] = make( ( ( in[ word ] >> shift ) | ( in[ word + 1 ] << 1 << ( 63 - shift ) ) ) & mask() );
+        }
+    }
+
+    /**
+     * store n values from in[0..n) at position pos onwards.
+     *
+     * Values are collected in a 64-bit accumulator that is written a word
+     * at a time, instead of a read-modify-write per value.
+     */
+    void pack( S const * in, size_type n, size_type pos ) type_noexcept
+    {
+        assert( pos + n <= count );
+
+        if ( n == 0 )
+            return;
+
+        std::uint64_t const bit  = std::uint64_t( pos ) * Bits;
+        std::uint64_t *     out  = words.data() + ( bit >> 6 );
+        unsigned            used = static_cast<unsigned>( bit & 63 );
+
+        std::uint64_t acc = *out & low_mask( used );
+
+        for ( size_type j = 0; j != n; ++j )
+        {
+            std::uint64_t const raw = encode( in[j] );
+
+            acc  |= raw << used;
+            used += Bits;
+
+            if ( used >= 64 )
+            {
+                *out++ = acc;
+                used  -= 64;
+                acc    = used != 0 ? raw >> ( Bits - used ) : 0;
+            }
+        }
+
+        *out = ( *out & ~low_mask( used ) ) | acc;
+    }
+
+    void push_back( S const & v )
+    {
+        resize( count + 1 );
+        set( count - 1, v );
+    }
+
+    void resize( size_type n )
+    {
+        if ( n < count )
+        {
+            // clear the bits past the new end, so that growing again yields zeroes:
+
+            std::uint64_t const bit = std::uint64_t( n ) * Bits;
+            words[ bit >> 6 ] &= low_mask( static_cast<unsigned>( bit & 63 ) );
+            std::fill( words.begin() + static_cast<difference_type>( ( bit >> 6 ) + 1 ), words.end(), std::uint64_t( 0 ) );
+        }
+        words.resize( word_count( n ), 0 );
+        count = n;
+    }
+
+    void clear()
+    {
+        words.assign( 1, 0 );
+        count = 0;
+    }
+
+    const_iterator begin() const { return const_iterator( this, 0 ); }
+    const_iterator end()   const { return const_iterator( this, count ); }
+
+    S front() const { return get( 0 ); }
+    S back()  const { return get( count - 1 ); }
+
+    size_type size()  const type_noexcept { return count; }
+    bool      empty() const type_noexcept { return count == 0; }
+
+    // storage used by the values, in bytes:
+
+    size_type size_bytes() const type_noexcept { return words.size() * sizeof( std::uint64_t ); }
+
+private:
+    static type_constexpr std::uint64_t mask() type_noexcept
+    {
+        return Bits == 64 ? ~std::uint64_t( 0 ) : ( std::uint64_t( 1 ) << ( Bits % 64 ) ) - 1;
+    }
+
+    static std::uint64_t low_mask( unsigned n ) type_noexcept
+    {
+        return n == 0 ? 0 : ~std::uint64_t( 0 ) >> ( 64 - n );
+    }
+
+    // words for n values, plus one readable word past the data:
+
+    static size_type word_count( size_type n ) type_noexcept
+    {
+        return static_cast<size_type>( ( std::uint64_t( n ) * Bits + 63 ) / 64 + 1 );
+    }
+
+    static std::uint64_t encode( S const & v ) type_noexcept
+    {
+        underlying_type const x = to_value( v );
+
+        assert( fits( x ) && "packed_array: value does not fit the number of bits" );
+
+        return static_cast<std::uint64_t>( x ) & mask();
+    }
+
+    static bool fits( underlying_type x ) type_noexcept
+    {
+        return std::is_signed<underlying_type>::value
+            ? Bits == 64 || ( static_cast<std::int64_t>( x ) >= -( std::int64_t( 1 ) << ( ( Bits - 1 ) % 64 ) )
+                           && static_cast<std::int64_t>( x ) <   ( std::int64_t( 1 ) << ( ( Bits - 1 ) % 64 ) ) )
+            : static_cast<std::uint64_t>( x ) <= mask();
+    }
+
+    static S make( std::uint64_t raw ) type_noexcept
+    {
+        return S( static_cast<underlying_type>( std::is_signed<underlying_type>::value
+            ? static_cast<std::uint64_t>( static_cast<std::int64_t>( raw << ( ( 64 - Bits ) % 64 ) ) >> ( ( 64 - Bits ) % 64 ) )
+            : raw ) );
+    }
+
+private:
+    std::vector<std::uint64_t> words;
+    size_type count;
+};
+
+template< typename S, unsigned Bits >
+const unsigned packed_array<S,Bits>::bits;
+
+}}  // namespace nonstd::types
+
+// make packed_array available in namespace nonstd:
+
+namespace nonstd {
+
+using types::packed_array;
+
+} // namespace nonstd
+
+#endif // type_CPP11_OR_GREATER
+
+#endif // NONSTD_TYPE_PACKED_ARRAY_HPP_INCLUDED
@@ -0,0 +1,238 @@
+// Copyright 2018-2022 Martin Moene
+//
+// type-lite, strong types for C++98 and later.
+// For more information see https://github.com/martinmoene/type-lite
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef NONSTD_TYPE_RADIX_SORT_HPP_INCLUDED
+#define NONSTD_TYPE_RADIX_SORT_HPP_INCLUDED
+
+#include "type.hpp"
+
+#if type_CPP11_OR_GREATER
+
+#include <algorithm>        // std::move()
+#include <cstddef>          // std::size_t
+#include <cstdint>          // std::uint32_t, std::uint64_t
+#include <cstring>          // std::memcpy()
+#include <iterator>         // std::iterator_traits<>
+#include <limits>
+#include <system_error>
+#include <thread>
+#include <type_traits>      // std::is_floating_point<>, std::make_unsigned<>
+#include <vector>
+
+namespace nonstd { namespace types {
+
+namespace detail {
+
+// unsigned integer of given size:
+
+template< std::size_t N > struct radix_uint;
+template<> struct radix_uint<4> { typedef std::uint32_t type; };
+template<> struct radix_uint<8> { typedef std::uint64_t type; };
+
+// order-preserving mapping of an arithmetic value to an unsigned key:
+
+template< typename T
+    , bool = std::is_floating_point<T>::value
+    , bool = std::is_signed<T>::value >
+struct radix_key;
+
+// unsigned integer: key is value:
+
+template< typename T >
+struct radix_key< T, false, false >
+{
+    typedef T type;
+
+    static type get( T v ) type_noexcept
+    {
+        return v;
+    }
+};
+
+// signed integer: flip sign bit:
+
+template< typename T >
+struct radix_key< T, false, true >
+{
+    typedef typename std::make_unsigned<T>::type type;
+
+    static type get( T v ) type_noexcept
+    {
+        return static_cast<type>( static_cast<type>( v ) ^ ( type(1) << ( std::numeric_limits<type>::digits - 1 ) ) );
+    }
+};
+
+// IEEE floating point: flip all bits of negatives, sign bit of positives;
+// the key of another size is not formed, to report only the static_assert:
+
+template< typename T >
+struct radix_key< T, true, true >
+{
+    static_assert( std::numeric_limits<T>::is_iec559 && ( sizeof(T) == 4 || sizeof(T) == 8 ),
+        "radix_sort: floating point underlying type must be a 32-bit or 64-bit IEEE type, such as float or double" );
+
+    typedef typename radix_uint< sizeof(T) == 4 ? 4 : 8 >::type type;
+
+    static type get( T v ) type_noexcept
+    {
+        type bits;
+        std::memcpy( &bits, &v, sizeof(T) );
+
+        type const sign = type(1) << ( std::numeric_limits<type>::digits - 1 );
+        return static_cast<type>( bits ^ ( ( bits & sign ) ? type(~type(0)) : sign ) );
+    }
+};
+
+// run f(0..n-1), f(0) on the calling thread, as well as f(i) of the
+// threads that cannot be started:
+
+template< typename F >
+void radix_parallel( unsigned n, F f )
+{
+    std::vector<std::thread> workers;
+    workers.reserve( n - 1 );
+
+    unsigned started = 1;
+
+    try
+    {
+        for ( ; started < n; ++started )
+            workers.emplace_back( f, started );
+    }
+    catch ( std::system_error const & ) {}
+
+    for ( unsigned i = started; i < n; ++i )
+        f( i );
+
+    f( 0u );
+
+    for ( std::thread & w : workers )
+        w.join();
+}
+
+} // namespace detail
+
+/**
+ * LSD radix sort of a contiguous range of strong types whose underlying
+ * type is an integer or an IEEE float.
+ *
+ * The sort is stable and orders as the underlying type, with -0.0 before
+ * +0.0 and NaNs ordered by their bit pattern. With threads > 1 each pass
+ * is split into as many chunks; threads == 0 selects the hardware
+ * concurrency. The result does not depend on the number of threads.
+ */
+template< typename ContiguousIt >
+void radix_sort( ContiguousIt first, ContiguousIt last, unsigned threads = 1 )
+{
+    typedef typename std::iterator_traits<ContiguousIt>::value_type value_type;
+    typedef typename value_type::underlying_type                   underlying_type;
+    typedef detail::radix_key<underlying_type>                     key;
+    typedef typename key::type                                     key_type;
+
+    static_assert( std::is_arithmetic<underlying_type>::value && !std::is_same<underlying_type, bool>::value,
+        "radix_sort: underlying type must be an integer or floating point type" );
+
+    std::size_t const radix  = 256;
+    unsigned    const passes = sizeof(key_type);
+
+    std::size_t const n = static_cast<std::size_t>( last - first );
+
+    if ( n < 2 )
+        return;
+
+    if ( threads == 0 )
+        threads = (std::max)( 1u, std::thread::hardware_concurrency() );
+
+    // limit the number of threads to keep chunks worthwhile:
+
+    std::size_t const min_chunk = 1u << 16;
+
+    if ( n / min_chunk < threads )
+        threads = static_cast<unsigned>( (std::max)( std::size_t(1), n / min_chunk ) );
+
+    std::vector<value_type> buffer( first, last );
+
+    value_type * src = &*first;
+    value_type * dst = buffer.data();
+
+    std::vector< std::size_t > hist( std::size_t( threads ) * radix );
+
+    for ( unsigned pass = 0; pass < passes; ++pass )
+    {
+        unsigned const shift = 8 * pass;
+
+        auto digit = [shift]( value_type const & v ) -> std::size_t
+        {
+            return static_cast<std::size_t>( ( key::get( to_value( v ) ) >> shift ) & 0xFF );
+        };
+
+        auto chunk_first = [n, threads]( unsigned t ) { return n * t / threads; };
+
+        std::fill( hist.begin(), hist.end(), std::size_t(0) );
+
+        detail::radix_parallel( threads, [&]( unsigned t )
+        {
+            std::size_t * h = &hist[ std::size_t( t ) * radix ];
+
+            for ( std::size_t i = chunk_first( t ), e = chunk_first( t + 1 ); i != e; ++i )
+                ++h[ digit( src[i] ) ];
+        });
+
+        // offsets: digit-major, then thread, keeps the sort stable:
+
+        bool trivial = false;
+        std::size_t running = 0;
+
+        for ( std::size_t d = 0; d < radix; ++d )
+        {
+            std::size_t const before = running;
+
+            for ( unsigned t = 0; t < threads; ++t )
+            {
+                std::size_t & h = hist[ std::size_t( t ) * radix + d ];
+                std::size_t const count = h;
+                h = running;
+                running += count;
+            }
+
+            trivial = trivial || running - before == n;
+        }
+
+        // all values share this digit:
+
+        if ( trivial )
+            continue;
+
+        detail::radix_parallel( threads, [&]( unsigned t )
+        {
+            std::size_t * h = &hist[ std::size_t( t ) * radix ];
+
+            for ( std::size_t i = chunk_first( t ), e = chunk_first( t + 1 ); i != e; ++i )
+                dst[ h[ digit( src[i] ) ]++ ] = std::move( src[i] );
+        });
+
+        std::swap( src, dst );
+    }
+
+    if ( src != &*first )
+        std::move( src, src + n, &*first );
+}
+
+}}  // namespace nonstd::types
+
+// make radix_sort available in namespace nonstd:
+
+namespace nonstd {
+
+using types::radix_sort;
+
+} // namespace nonstd
+
+#endif // type_CPP11_OR_GREATER
+
+#endif // NONSTD_TYPE_RADIX_SORT_HPP_INCLUDED
@@ -0,0 +1,265 @@
+// Copyright 2018-2022 Martin Moene
+//
+// type-lite, strong types for C++98 and later.
+// For more information see https://github.com/martinmoene/type-lite
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef NONSTD_TYPE_RANGED_HPP_INCLUDED
+#define NONSTD_TYPE_RANGED_HPP_INCLUDED
+
+#include "type.hpp"
+
+#if type_CPP11_OR_GREATER
+
+#include <cassert>
+#include <cstdint>          // std::intmax_t, std::uint8_t, ...
+#include <limits>
+#include <type_traits>      // std::conditional<>, std::is_integral<>
+
+namespace nonstd { namespace types {
+
+namespace detail {
+
+// smallest integer type holding [Lo..Hi], unsigned if possible:
+
+template< std::intmax_t Lo, std::intmax_t Hi, typename T >
+struct ranged_fits
+{
+    static const bool value =
+        Lo >= static_cast<std::intmax_t>( (std::numeric_limits<T>::min)() ) &&
+        ( std::numeric_limits<T>::digits >= std::numeric_limits<std::intmax_t>::digits ||
+          Hi <= static_cast<std::intmax_t>( (std::numeric_limits<T>::max)() ) );
+};
+
+template< std::intmax_t Lo, std::intmax_t Hi, typename T, typename... Ts >
+struct ranged_select
+{
+    typedef typename std::conditional< ranged_fits<Lo,Hi,T>::value, T, typename ranged_select<Lo,Hi,Ts...>::type >::type type;
+};
+
+template< std::intmax_t Lo, std::intmax_t Hi, typename T >
+struct ranged_select<Lo,Hi,T>
+{
+    typedef T type;
+};
+
+template< std::intmax_t Lo, std::intmax_t Hi >
+struct ranged_storage : ranged_select< Lo, Hi
+    , std::uint8_t , std::int8_t
+    , std::uint16_t, std::int16_t
+    , std::uint32_t, std::int32_t
+    , std::uint64_t, std::int64_t >
+{};
+
+// compile-time bound arithmetic, false on overflow:
+
+type_constexpr std::intmax_t ranged_max = (std::numeric_limits<std::intmax_t>::max)();
+type_constexpr std::intmax_t ranged_min = (std::numeric_limits<std::intmax_t>::min)();
+
+inline type_constexpr bool ranged_add_ok( std::intmax_t a, std::intmax_t b )
+{
+    return b > 0 ? a <= ranged_max - b : a >= ranged_min - b;
+}
+
+inline type_constexpr bool ranged_sub_ok( std::intmax_t a, std::intmax_t b )
+{
+    return b > 0 ? a >= ranged_min + b : a <= ranged_max + b;
+}
+
+inline type_constexpr bool ranged_mul_ok( std::intmax_t a, std::intmax_t b )
+{
+    return a == 0 || b == 0 ? true
+        : a > 0 ? ( b > 0 ? a <= ranged_max / b : b >= ranged_min / a )
+                : ( b > 0 ? a >= ranged_min / b : a >= ranged_max / b );
+}
+
+inline type_constexpr std::intmax_t ranged_min4( std::intmax_t a, std::intmax_t b, std::intmax_t c, std::intmax_t d )
+{
+    return ( a < b ? a : b ) < ( c < d ? c : d ) ? ( a < b ? a : b ) : ( c < d ? c : d );
+}
+
+inline type_constexpr std::intmax_t ranged_max4( std::intmax_t a, std::intmax_t b, std::intmax_t c, std::intmax_t d )
+{
+    return ( a > b ? a : b ) > ( c > d ? c : d ) ? ( a > b ? a : b ) : ( c > d ? c : d );
+}
+
+// default value: zero if in range, otherwise the bound nearest to zero:
+
+template< std::intmax_t Lo, std::intmax_t Hi >
+struct ranged_default
+{
+    typedef typename ranged_storage<Lo,Hi>::type storage;
+    typedef custom_default_t< storage, static_cast<storage>( Lo > 0 ? Lo : Hi < 0 ? Hi : 0 ) > type;
+};
+
+} // namespace detail
+
+/**
+ * ranged, integer in [Lo..Hi], stored in the smallest integer type that
+ * holds the range, such as std::uint8_t for [0..200].
+ *
+ * Construction and compound assignment check the range in debug builds
+ * (assert). Arithmetic between ranged values of the same tag yields the
+ * ranged type of the result's range, so a sum of two [0..200] values is
+ * a [0..400] value stored in std::uint16_t.
+ */
+template< std::intmax_t Lo, std::intmax_t Hi, typename Tag >
+struct ranged
+    : type< typename detail::ranged_storage<Lo,Hi>::type, Tag, typename detail::ranged_default<Lo,Hi>::type >
+{
+    static_assert( Lo <= Hi, "ranged: lower bound must not exceed upper bound" );
+
+    typedef typename detail::ranged_storage<Lo,Hi>::type storage_type;
+    typedef type< storage_type, Tag, typename detail::ranged_default<Lo,Hi>::type > base_type;
+
+    static type_constexpr std::intmax_t lowest()  { return Lo; }
+    static type_constexpr std::intmax_t highest() { return Hi; }
+
+    type_constexpr ranged()
+        : base_type()
+    {}
+
+    template< typename U type_REQUIRES_T( std::is_integral<U>::value ) >
+    type_constexpr explicit ranged( U v )
+        : base_type( checked( v ) )
+    {}
+
+    // widening from a ranged value of the same tag whose range is contained in this one:
+
+    template< std::intmax_t L, std::intmax_t H type_REQUIRES_T( Lo <= L && H <= Hi ) >
+    type_constexpr ranged( ranged<L,H,Tag> const & other )
+        : base_type( static_cast<storage_type>( other.get() ) )
+    {}
+
+    // narrowing from a ranged value of the same tag, checked:
+
+    template< std::intmax_t L, std::intmax_t H type_REQUIRES_T( !( Lo <= L && H <= Hi ) ) >
+    type_constexpr explicit ranged( ranged<L,H,Tag> const & other )
+        : base_type( checked( other.value() ) )
+    {}
+
+    // the value as the widest integer type:
+
+    type_constexpr std::intmax_t value() const
+    {
+        return static_cast<std::intmax_t>( this->get() );
+    }
+
+    type_constexpr14 ranged & operator+=( ranged const & y ) { this->get() = checked( value() + y.value() ); return *this; }
+    type_constexpr14 ranged & operator-=( ranged const & y ) { this->get() = checked( value() - y.value() ); return *this; }
+
+    type_constexpr14 ranged & operator++() { this->get() = checked( value() + 1 ); return *this; }
+    type_constexpr14 ranged & operator--() { this->get() = checked( value() - 1 ); return *this; }
+
+    type_constexpr14 ranged   operator++( int ) { ranged tmp( *this ); ++*this; return tmp; }
+    type_constexpr14 ranged   operator--( int ) { ranged tmp( *this ); --*this; return tmp; }
+
+private:
+    template< typename U >
+    static type_constexpr bool in_range( U v )
+    {
+        return std::is_signed<U>::value
+            ? static_cast<std::intmax_t>( v ) >= Lo && static_cast<std::intmax_t>( v ) <= Hi
+            : Hi >= 0 && static_cast<std::uintmax_t>( v ) <= static_cast<std::uintmax_t>( Hi )
+                      && ( Lo <= 0 || static_cast<std::uintmax_t>( v ) >= static_cast<std::uintmax_t>( Lo ) );
+    }
+
+    template< typename U >
+    static type_constexpr storage_type checked( U v )
+    {
+        return assert( in_range( v ) && "ranged: value out of range" ), static_cast<storage_type>( v );
+    }
+};
+
+// comparison of ranged values of the same tag:
+
+template< std::intmax_t L1, std::intmax_t H1, std::intmax_t L2, std::intmax_t H2, typename Tag >
+inline type_constexpr bool operator==( ranged<L1,H1,Tag> const & x, ranged<L2,H2,Tag> const & y ) { return x.value() == y.value(); }
+
+template< std::intmax_t L1, std::intmax_t H1, std::intmax_t L2, std::intmax_t H2, typename Tag >
+inline type_constexpr bool operator!=( ranged<L1,H1,Tag> const & x, ranged<L2,H2,Tag> const & y ) { return x.value() != y.value(); }
+
+template< std::intmax_t L1, std::intmax_t H1, std::intmax_t L2, std::intmax_t H2, typename Tag >
+inline type_constexpr bool operator< ( ranged<L1,H1,Tag> const & x, ranged<L2,H2,Tag> const & y ) { return x.value() <  y.value(); }
+
+template< std::intmax_t L1, std::intmax_t H1, std::intmax_t L2, std::intmax_t H2, typename Tag >
+inline type_constexpr bool operator<=( ranged<L1,H1,Tag> const & x, ranged<L2,H2,Tag> const & y ) { return x.value() <= y.value(); }
+
+template< std::intmax_t L1, std::intmax_t H1, std::intmax_t L2, std::intmax_t H2, typename Tag >
+inline type_constexpr bool operator> ( ranged<L1,H1,Tag> const & x, ranged<L2,H2,Tag> const & y ) { return x.value() >  y.value(); }
+
+template< std::intmax_t L1, std::intmax_t H1, std::intmax_t L2, std::intmax_t H2, typename Tag >
+inline type_constexpr bool operator>=( ranged<L1,H1,Tag> const & x, ranged<L2,H2,Tag> const & y ) { return x.value() >= y.value(); }
+
+// widening arithmetic: the result's range follows from the operands' ranges:
+
+namespace detail {
+
+template< std::intmax_t L1, std::intmax_t H1, std::intmax_t L2, std::intmax_t H2, typename Tag >
+struct ranged_plus
+{
+    static_assert( ranged_add_ok( L1, L2 ) && ranged_add_ok( H1, H2 ), "ranged: range of sum overflows std::intmax_t" );
+    typedef ranged< L1 + L2, H1 + H2, Tag > type;
+};
+
+template< std::intmax_t L1, std::intmax_t H1, std::intmax_t L2, std::intmax_t H2, typename Tag >
+struct ranged_minus
+{
+    static_assert( ranged_sub_ok( L1, H2 ) && ranged_sub_ok( H1, L2 ), "ranged: range of difference overflows std::intmax_t" );
+    typedef ranged< L1 - H2, H1 - L2, Tag > type;
+};
+
+template< std::intmax_t L1, std::intmax_t H1, std::intmax_t L2, std::intmax_t H2, typename Tag >
+struct ranged_multiplies
+{
+    static_assert( ranged_mul_ok( L1, L2 ) && ranged_mul_ok( L1, H2 ) && ranged_mul_ok( H1, L2 ) && ranged_mul_ok( H1, H2 ),
+        "ranged: range of product overflows std::intmax_t" );
+    typedef ranged< ranged_min4( L1 * L2, L1 * H2, H1 * L2, H1 * H2 )
+                  , ranged_max4( L1 * L2, L1 * H2, H1 * L2, H1 * H2 ), Tag > type;
+};
+
+} // namespace detail
+
+template< std::intmax_t L1, std::intmax_t H1, std::intmax_t L2, std::intmax_t H2, typename Tag >
+inline type_constexpr typename detail::ranged_plus<L1,H1,L2,H2,Tag>::type
+operator+( ranged<L1,H1,Tag> const & x, ranged<L2,H2,Tag> const & y )
+{
+    return typename detail::ranged_plus<L1,H1,L2,H2,Tag>::type( x.value() + y.value() );
+}
+
+template< std::intmax_t L1, std::intmax_t H1, std::intmax_t L2, std::intmax_t H2, typename Tag >
+inline type_constexpr typename detail::ranged_minus<L1,H1,L2,H2,Tag>::type
+operator-( ranged<L1,H1,Tag> const & x, ranged<L2,H2,Tag> const & y )
+{
+    return typename detail::ranged_minus<L1,H1,L2,H2,Tag>::type( x.value() - y.value() );
+}
+
+template< std::intmax_t L1, std::intmax_t H1, std::intmax_t L2, std::intmax_t H2, typename Tag >
+inline type_constexpr typename detail::ranged_multiplies<L1,H1,L2,H2,Tag>::type
+operator*( ranged<L1,H1,Tag> const & x, ranged<L2,H2,Tag> const & y )
+{
+    return typename detail::ranged_multiplies<L1,H1,L2,H2,Tag>::type( x.value() * y.value() );
+}
+
+template< std::intmax_t Lo, std::intmax_t Hi, typename Tag >
+inline type_constexpr typename detail::ranged_minus<0,0,Lo,Hi,Tag>::type
+operator-( ranged<Lo,Hi,Tag> const & x )
+{
+    return typename detail::ranged_minus<0,0,Lo,Hi,Tag>::type( -x.value() );
+}
+
+}}  // namespace nonstd::types
+
+// make ranged available in namespace nonstd:
+
+namespace nonstd {
+
+using types::ranged;
+
+} // namespace nonstd
+
+#endif // type_CPP11_OR_GREATER
+
+#endif // NONSTD_TYPE_RANGED_HPP_INCLUDED
@@ -0,0 +1,369 @@
+// Copyright 2018-2022 Martin Moene
+//
+// type-lite, strong types for C++98 and later.
+// For more information see https://github.com/martinmoene/type-lite
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef NONSTD_TYPE_REDUCE_HPP_INCLUDED
+#define NONSTD_TYPE_REDUCE_HPP_INCLUDED
+
+#include "type.hpp"
+
+#if type_CPP11_OR_GREATER
+
+#include <algorithm>        // std::min(), std::max()
+#include <cassert>
+#include <cmath>            // std::abs()
+#include <cstddef>          // std::size_t
+#include <iterator>         // std::iterator_traits<>
+#include <system_error>
+#include <thread>
+#include <type_traits>      // std::is_floating_point<>
+#include <utility>          // std::pair<>
+#include <vector>
+
+namespace nonstd { namespace types {
+
+namespace detail {
+
+// elements per chunk; fixed, so that results do not depend on the number of threads:
+
+type_constexpr std::size_t reduce_chunk = 1u << 14;
+
+// independent accumulators per chunk, so that the compiler can vectorize:
+
+type_constexpr std::size_t reduce_lanes = 8;
+
+// true if S supports x + y, respectively x < y, yielding S, respectively bool:
+
+template< typename S, typename = void >
+struct reduce_has_plus : std::false_type {};
+
+template< typename S >
+struct reduce_has_plus< S, typename std::enable_if< std::is_convertible< decltype( std::declval<S const &>() + std::declval<S const &>() ), S >::value >::type > : std::true_type {};
+
+template< typename S, typename = void >
+struct reduce_has_less : std::false_type {};
+
+template< typename S >
+struct reduce_has_less< S, typename std::enable_if< std::is_convertible< decltype( std::declval<S const &>() < std::declval<S const &>() ), bool >::value >::type > : std::true_type {};
+
+// partial results of chunk(first, last) for the chunks of [0..n), in order;
+// with threads > 1, thread t handles chunks t, t + threads, ...:
+
+template< typename P, typename F >
+std::vector<P> reduce_chunks( std::size_t n, unsigned threads, P const & seed, F chunk )
+{
+    std::size_t const chunks = ( n + reduce_chunk - 1 ) / reduce_chunk;
+
+    if ( threads == 0 )
+        threads = (std::max)( 1u, std::thread::hardware_concurrency() );
+
+    if ( chunks < threads )
+        threads = static_cast<unsigned>( (std::max)( std::size_t(1), chunks ) );
+
+    std::vector<P> partial( chunks, seed );
+
+    auto work = [&]( unsigned t )
+    {
+        for ( std::size_t c = t; c < chunks; c += threads )
+            partial[c] = chunk( c * reduce_chunk, (std::min)( n, ( c + 1 ) * reduce_chunk ) );
+    };
+
+    std::vector<std::thread> workers;
+    workers.reserve( threads - 1 );
+
+    // the work of threads that cannot be started is done on this thread;
+    // started threads are joined before an exception leaves:
+
+    unsigned started = 1;
+
+    try
+    {
+        for ( ; started < threads; ++started )
+            workers.emplace_back( work, started );
+    }
+    catch ( std::system_error const & ) {}
+
+    try
+    {
+        for ( unsigned t = started; t < threads; ++t )
+            work( t );
+
+        work( 0u );
+    }
+    catch ( ... )
+    {
+        for ( std::thread & w : workers )
+            w.join();
+        throw;
+    }
+
+    for ( std::thread & w : workers )
+        w.join();
+
+    return partial;
+}
+
+// sum of underlying values p[first..last) in reduce_lanes lanes:
+
+template< typename S >
+typename S::underlying_type reduce_sum_chunk( S const * p, std::size_t first, std::size_t last )
+{
+    typedef typename S::underlying_type T;
+
+    T acc[ reduce_lanes ] = {};
+
+    std::size_t i = first;
+
+    for ( ; i + reduce_lanes <= last; i += reduce_lanes )
+        for ( std::size_t k = 0; k != reduce_lanes; ++k )
+            acc[k] = static_cast<T>( acc[k] + p[i + k].get() );
+
+    for ( std::size_t k = 0; i != last; ++i, ++k )
+        acc[k] = static_cast<T>( acc[k] + p[i].get() );
+
+    for ( std::size_t w = reduce_lanes / 2; w > 0; w /= 2 )
+        for ( std::size_t k = 0; k != w; ++k )
+            acc[k] = static_cast<T>( acc[k] + acc[k + w] );
+
+    return acc[0];
+}
+
+// Neumaier summation: sum and compensation:
+
+template< typename T >
+struct reduce_neumaier
+{
+    T sum;
+    T c;
+
+    void add( T x )
+    {
+        T const t = sum + x;
+        c += std::abs( sum ) >= std::abs( x ) ? ( sum - t ) + x : ( x - t ) + sum;
+        sum = t;
+    }
+
+    T value() const
+    {
+        return sum + c;
+    }
+};
+
+// smallest and largest underlying value of p[first..last), in reduce_lanes lanes:
+
+template< typename S >
+std::pair< typename S::underlying_type, typename S::underlying_type > reduce_minmax_chunk( S const * p, std::size_t first, std::size_t last )
+{
+    typedef typename S::underlying_type T;
+
+    T lo[ reduce_lanes ], hi[ reduce_lanes ];
+
+    for ( std::size_t k = 0; k != reduce_lanes; ++k )
+        lo[k] = hi[k] = p[first].get();
+
+    std::size_t i = first;
+
+    for ( ; i + reduce_lanes <= last; i += reduce_lanes )
+    {
+        for ( std::size_t k = 0; k != reduce_lanes; ++k )
+        {
+            T const x = p[i + k].get();
+            lo[k] = x < lo[k] ? x : lo[k];
+            hi[k] = hi[k] < x ? x : hi[k];
+        }
+    }
+
+    for ( std::size_t k = 0; i != last; ++i, ++k )
+    {
+        T const x = p[i].get();
+        lo[k] = x < lo[k] ? x : lo[k];
+        hi[k] = hi[k] < x ? x : hi[k];
+    }
+
+    for ( std::size_t k = 1; k != reduce_lanes; ++k )
+    {
+        lo[0] = lo[k] < lo[0] ? lo[k] : lo[0];
+        hi[0] = hi[0] < hi[k] ? hi[k] : hi[0];
+    }
+
+    return std::make_pair( lo[0], hi[0] );
+}
+
+template< typename ContiguousIt >
+typename std::iterator_traits<ContiguousIt>::value_type const * reduce_data( ContiguousIt first )
+{
+    return &*first;
+}
+
+} // namespace detail
+
+// The following reductions operate on a contiguous range of strong values,
+// such as a std::vector<>, in chunks of a fixed size. Their names do not
+// collide with those of the standard algorithms, which argument-dependent
+// lookup would otherwise also find via the iterators of such a range. With
+// threads > 1 the chunks are divided over as many threads; threads == 0
+// selects the hardware concurrency. The chunk results are combined in
+// order, so that the result does not depend on the number of threads.
+
+/**
+ * reduce [first..last) with associative operation op, starting with init.
+ */
+template< typename ContiguousIt, typename S, typename BinaryOp >
+S strong_reduce( ContiguousIt first, ContiguousIt last, S init, BinaryOp op, unsigned threads = 1 )
+{
+    std::size_t const n = static_cast<std::size_t>( last - first );
+
+    if ( n == 0 )
+        return init;
+
+    auto const p = detail::reduce_data( first );
+
+    std::vector<S> const partial = detail::reduce_chunks( n, threads, init, [&]( std::size_t b, std::size_t e )
+    {
+        S acc = p[b];
+        for ( std::size_t i = b + 1; i != e; ++i )
+            acc = op( acc, p[i] );
+        return acc;
+    } );
+
+    for ( S const & x : partial )
+        init = op( init, x );
+
+    return init;
+}
+
+/**
+ * sum of [first..last), computed on the underlying values, as strong value.
+ */
+template< typename ContiguousIt >
+typename std::iterator_traits<ContiguousIt>::value_type strong_sum( ContiguousIt first, ContiguousIt last, unsigned threads = 1 )
+{
+    typedef typename std::iterator_traits<ContiguousIt>::value_type S;
+    typedef typename S::underlying_type T;
+
+    static_assert( detail::reduce_has_plus<S>::value, "strong_sum: strong type must provide operator+" );
+
+    std::size_t const n = static_cast<std::size_t>( last - first );
+    auto const p = n == 0 ? nullptr : detail::reduce_data( first );
+
+    std::vector<T> const partial = n == 0 ? std::vector<T>() : detail::reduce_chunks( n, threads, T(), [&]( std::size_t b, std::size_t e )
+    {
+        return detail::reduce_sum_chunk( p, b, e );
+    } );
+
+    T result = T();
+    for ( T const & x : partial )
+        result = static_cast<T>( result + x );
+
+    return S( result );
+}
+
+/**
+ * sum of [first..last) of a floating-point underlying type with Neumaier's
+ * compensated summation, as strong value; not vectorized.
+ */
+template< typename ContiguousIt >
+typename std::iterator_traits<ContiguousIt>::value_type strong_sum_compensated( ContiguousIt first, ContiguousIt last, unsigned threads = 1 )
+{
+    typedef typename std::iterator_traits<ContiguousIt>::value_type S;
+    typedef typename S::underlying_type T;
+    typedef detail::reduce_neumaier<T> neumaier;
+
+    static_assert( detail::reduce_has_plus<S>::value, "strong_sum_compensated: strong type must provide operator+" );
+    static_assert( std::is_floating_point<T>::value, "strong_sum_compensated: underlying type must be a floating point type" );
+
+    std::size_t const n = static_cast<std::size_t>( last - first );
+    auto const p = n == 0 ? nullptr : detail::reduce_data( first );
+
+    std::vector<neumaier> const partial = n == 0 ? std::vector<neumaier>() : detail::reduce_chunks( n, threads, neumaier(), [&]( std::size_t b, std::size_t e )
+    {
+        neumaier acc = { T(), T() };
+        for ( std::size_t i = b; i != e; ++i )
+            acc.add( p[i].get() );
+        return acc;
+    } );
+
+    neumaier result = { T(), T() };
+    for ( neumaier const & x : partial )
+    {
+        result.add( x.sum );
+        result.c += x.c;
+    }
+
+    return S( result.value() );
+}
+
+/**
+ * smallest and largest value of non-empty range [first..last).
+ */
+template< typename ContiguousIt >
+std::pair< typename std::iterator_traits<ContiguousIt>::value_type, typename std::iterator_traits<ContiguousIt>::value_type >
+strong_minmax( ContiguousIt first, ContiguousIt last, unsigned threads = 1 )
+{
+    typedef typename std::iterator_traits<ContiguousIt>::value_type S;
+    typedef typename S::underlying_type T;
+    typedef std::pair<T, T> bounds;
+
+    static_assert( detail::reduce_has_less<S>::value, "strong_minmax: strong type must provide operator<" );
+
+    std::size_t const n = static_cast<std::size_t>( last - first );
+
+    assert( n > 0 && "strong_minmax: range must not be empty" );
+
+    auto const p = detail::reduce_data( first );
+
+    std::vector<bounds> const partial = detail::reduce_chunks( n, threads, bounds(), [&]( std::size_t b, std::size_t e )
+    {
+        return detail::reduce_minmax_chunk( p, b, e );
+    } );
+
+    bounds result = partial.front();
+    for ( bounds const & x : partial )
+    {
+        result.first  = x.first  < result.first  ? x.first  : result.first;
+        result.second = result.second < x.second ? x.second : result.second;
+    }
+
+    return std::make_pair( S( result.first ), S( result.second ) );
+}
+
+/**
+ * smallest value of non-empty range [first..last).
+ */
+template< typename ContiguousIt >
+typename std::iterator_traits<ContiguousIt>::value_type strong_min( ContiguousIt first, ContiguousIt last, unsigned threads = 1 )
+{
+    return types::strong_minmax( first, last, threads ).first;
+}
+
+/**
+ * largest value of non-empty range [first..last).
+ */
+template< typename ContiguousIt >
+typename std::iterator_traits<ContiguousIt>::value_type strong_max( ContiguousIt first, ContiguousIt last, unsigned threads = 1 )
+{
+    return types::strong_minmax( first, last, threads ).second;
+}
+
+}}  // namespace nonstd::types
+
+// make the reductions available in namespace nonstd:
+
+namespace nonstd {
+
+using types::strong_reduce;
+using types::strong_sum;
+using types::strong_sum_compensated;
+using types::strong_min;
+using types::strong_max;
+using types::strong_minmax;
+
+} // namespace nonstd
+
+#endif // type_CPP11_OR_GREATER
+
+#endif // NONSTD_TYPE_REDUCE_HPP_INCLUDED
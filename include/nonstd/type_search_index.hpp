@@ -0,0 +1,281 @@
+// Copyright 2018-2022 Martin Moene
+//
+// type-lite, strong types for C++98 and later.
+// For more information see https://github.com/martinmoene/type-lite
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef NONSTD_TYPE_SEARCH_INDEX_HPP_INCLUDED
+#define NONSTD_TYPE_SEARCH_INDEX_HPP_INCLUDED
+
+#include "type.hpp"
+
+#if type_CPP11_OR_GREATER
+
+#include <cstddef>          // std::size_t
+#include <cstdint>          // std::uintptr_t
+#include <iterator>         // std::iterator_traits<>
+#include <memory>           // std::unique_ptr<>
+#include <type_traits>      // std::is_scalar<>
+#include <utility>          // std::move()
+#include <vector>
+
+#if defined(_MSC_VER) && !defined(__clang__)
+# include <intrin.h>        // _BitScanForward64(), _BitScanReverse64(), _mm_prefetch()
+#endif
+
+namespace nonstd { namespace types {
+
+namespace detail {
+
+// number of trailing zero bits of a non-zero value:
+
+inline unsigned search_ctz( std::size_t x ) type_noexcept
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return static_cast<unsigned>( __builtin_ctzll( x ) );
+#elif defined(_MSC_VER) && defined(_WIN64)
+    unsigned long pos;
+    _BitScanForward64( &pos, x );
+    return pos;
+#else
+    unsigned n = 0;
+    for ( ; ( x & 1u ) == 0; x >>= 1 )
+        ++n;
+    return n;
+#endif
+}
+
+// position of the highest set bit of a non-zero value:
+
+inline unsigned search_log2( std::size_t x ) type_noexcept
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return static_cast<unsigned>( 63 - __builtin_clzll( x ) );
+#elif defined(_MSC_VER) && defined(_WIN64)
+    unsigned long pos;
+    _BitScanReverse64( &pos, x );
+    return pos;
+#else
+    unsigned n = 0;
+    for ( ; x > 1; x >>= 1 )
+        ++n;
+    return n;
+#endif
+}
+
+// hint to load the cache line at given address:
+
+inline void search_prefetch( void const * p ) type_noexcept
+{
+#if defined(__GNUC__) || defined(__clang__)
+    __builtin_prefetch( p );
+#elif defined(_MSC_VER) && ( defined(_M_X64) || defined(_M_IX86) )
+    _mm_prefetch( static_cast<char const *>( p ), _MM_HINT_T0 );
+#else
+    (void) p;
+#endif
+}
+
+} // namespace detail
+
+/**
+ * search_index, read-only lower_bound/upper_bound search structure over a
+ * sorted range of ordered strong keys.
+ *
+ * Keys are stored in Eytzinger (breadth-first) layout, node k at keys[k],
+ * with keys[0] unused and aligned to the cache line. So the descendants
+ * k*B..k*B+B-1 of node k a cache line of B keys down fill exactly one line,
+ * which is prefetched while the current level is compared. Comparisons
+ * select the next node arithmetically instead of branching, and the
+ * position of a node in the sorted input follows from its index.
+ *
+ * Results are positions in the sorted input, of strong type Index; size()
+ * is returned if no such position exists.
+ */
+template< typename Key, typename Index = numeric<std::size_t, Key> >
+class search_index
+{
+public:
+    typedef Key                             key_type;
+    typedef Index                           index_type;
+    typedef typename Key::underlying_type   underlying_type;
+    typedef std::size_t                     size_type;
+
+    static_assert( std::is_scalar<underlying_type>::value,
+        "search_index: underlying type of key must be a scalar type" );
+
+    // build from a sorted range of keys:
+
+    template< typename ForwardIt >
+    search_index( ForwardIt first, ForwardIt last )
+        : count( static_cast<size_type>( std::distance( first, last ) ) )
+        , storage( new unsigned char[ ( count + 1 ) * sizeof(underlying_type) + cache_line ] )
+        , keys( aligned( storage.get() ) )
+        , height( count == 0 ? 0 : detail::search_log2( count ) )
+    {
+        std::vector<underlying_type> sorted;
+        sorted.reserve( count );
+
+        for ( ; first != last; ++first )
+            sorted.push_back( to_value( *first ) );
+
+        size_type rank = 0;
+        build( sorted, rank, 1 );
+    }
+
+    // a moved-from index is empty:
+
+    search_index( search_index && other ) type_noexcept
+        : count  ( other.count )
+        , storage( std::move( other.storage ) )
+        , keys   ( other.keys )
+        , height ( other.height )
+    {
+        other.reset();
+    }
+
+    search_index & operator=( search_index && other ) type_noexcept
+    {
+        if ( this != &other )
+        {
+            count   = other.count;
+            storage = std::move( other.storage );
+            keys    = other.keys;
+            height  = other.height;
+
+            other.reset();
+        }
+        return *this;
+    }
+
+    // first position whose key is not less than x:
+
+    index_type lower_bound( key_type const & x ) const type_noexcept
+    {
+        return position( lower_node( to_value( x ) ) );
+    }
+
+    // first position whose key is greater than x:
+
+    index_type upper_bound( key_type const & x ) const type_noexcept
+    {
+        underlying_type const v = to_value( x );
+
+        size_type k = 1;
+        while ( k <= count )
+        {
+            prefetch( k );
+            k = 2 * k + static_cast<size_type>( !( v < keys[k] ) );
+        }
+        return position( settle( k ) );
+    }
+
+    bool contains( key_type const & x ) const type_noexcept
+    {
+        underlying_type const v = to_value( x );
+        size_type const k = lower_node( v );
+
+        return k != 0 && !( v < keys[k] );
+    }
+
+    size_type size()  const type_noexcept { return count; }
+    bool      empty() const type_noexcept { return count == 0; }
+
+private:
+    // number of keys per cache line:
+
+    static const size_type cache_line = 64;
+    static const size_type per_line   = cache_line % sizeof(underlying_type) == 0 ? cache_line / sizeof(underlying_type) : 1;
+
+    static underlying_type * aligned( unsigned char * p ) type_noexcept
+    {
+        std::uintptr_t const addr = reinterpret_cast<std::uintptr_t>( p );
+        return reinterpret_cast<underlying_type *>( ( addr + cache_line - 1 ) & ~std::uintptr_t( cache_line - 1 ) );
+    }
+
+    // fill in-order, yielding breadth-first layout; node k has children 2k, 2k+1:
+
+    void build( std::vector<underlying_type> const & sorted, size_type & rank, size_type k )
+    {
+        if ( k <= count )
+        {
+            build( sorted, rank, 2 * k );
+            keys[k] = sorted[ rank++ ];
+            build( sorted, rank, 2 * k + 1 );
+        }
+    }
+
+    // prefetch the descendants of node k a cache line deep:
+
+    void prefetch( size_type k ) const type_noexcept
+    {
+        detail::search_prefetch( reinterpret_cast<void const *>(
+            reinterpret_cast<std::uintptr_t>( keys ) + k * per_line * sizeof(underlying_type) ) );
+    }
+
+    // node of the first key not less than v, 0 if none:
+
+    size_type lower_node( underlying_type const & v ) const type_noexcept
+    {
+        size_type k = 1;
+        while ( k <= count )
+        {
+            prefetch( k );
+            k = 2 * k + static_cast<size_type>( keys[k] < v );
+        }
+        return settle( k );
+    }
+
+    // undo the trailing right turns (1 bits) and the final left turn:
+
+    static size_type settle( size_type k ) type_noexcept
+    {
+        return k >> ( detail::search_ctz( ~k ) + 1 );
+    }
+
+    // position of node k in the sorted input, count for node 0: the in-order
+    // rank r of k in the perfect tree of the same height, less the missing
+    // leaves of the last level before it; the m leaves present have ranks
+    // 0, 2, .. 2m-2 in that tree and the missing ones 2m, 2m+2, ...:
+
+    index_type position( size_type k ) const type_noexcept
+    {
+        if ( k == 0 )
+            return index_type( count );
+
+        size_type const depth = detail::search_log2( k );
+        size_type const r     = ( ( 2 * ( k - ( size_type(1) << depth ) ) + 1 ) << ( height - depth ) ) - 1;
+        size_type const m2    = 2 * ( count - ( size_type(1) << height ) + 1 );
+
+        return index_type( r < m2 ? r : ( r + m2 - 1 ) / 2 );
+    }
+
+    void reset() type_noexcept
+    {
+        count  = 0;
+        keys   = nullptr;
+        height = 0;
+    }
+
+private:
+    size_type count;
+    std::unique_ptr<unsigned char[]> storage;
+    underlying_type * keys;
+    size_type height;       // depth of the last level
+};
+
+}}  // namespace nonstd::types
+
+// make search_index available in namespace nonstd:
+
+namespace nonstd {
+
+using types::search_index;
+
+} // namespace nonstd
+
+#endif // type_CPP11_OR_GREATER
+
+#endif // NONSTD_TYPE_SEARCH_INDEX_HPP_INCLUDED
@@ -0,0 +1,238 @@
+// Copyright 2018-2022 Martin Moene
+//
+// type-lite, strong types for C++98 and later.
+// For more information see https://github.com/martinmoene/type-lite
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef NONSTD_TYPE_SLOT_MAP_HPP_INCLUDED
+#define NONSTD_TYPE_SLOT_MAP_HPP_INCLUDED
+
+#include "type_handle.hpp"
+
+#if type_CPP11_OR_GREATER
+
+#include <cassert>
+#include <cstddef>          // std::size_t
+#include <utility>          // std::move(), std::forward()
+#include <vector>
+
+namespace nonstd { namespace types {
+
+/**
+ * slot_map, values of type T addressed by generational handles of type
+ * Handle, such as handle<EntityTag>, with O(1) insert, erase and lookup.
+ *
+ * Values are stored densely, in unspecified order: erase moves the last
+ * value into the erased position. A slot whose generation is exhausted is
+ * retired rather than reused, so that a stale handle never finds a value.
+ */
+template< typename T, typename Handle >
+class slot_map
+{
+public:
+    typedef T                                           value_type;
+    typedef Handle                                      handle_type;
+    typedef std::size_t                                 size_type;
+    typedef typename std::vector<T>::iterator           iterator;
+    typedef typename std::vector<T>::const_iterator     const_iterator;
+
+    slot_map()
+        : free_head( no_slot() )
+    {}
+
+    handle_type insert( T const & v ) { return emplace( v ); }
+    handle_type insert( T && v )      { return emplace( std::move( v ) ); }
+
+    // the handle of the new value, or the null handle if all handle indices
+    // are in use; slots and owners get room first and the value is constructed
+    // last, so that a throwing allocation or constructor leaves the map unchanged:
+
+    template< typename... Args >
+    handle_type emplace( Args &&... args )
+    {
+        if ( full() )
+            return handle_type();
+
+        if ( free_head == no_slot() )
+            make_room_for_one( slots );
+
+        make_room_for_one( owners );
+
+        values.emplace_back( std::forward<Args>( args )... );
+
+        word const s = acquire_slot();
+
+        owners.push_back( s );
+        slots[s].position = static_cast<word>( values.size() - 1 );
+
+        return handle_type( s, slots[s].generation );
+    }
+
+    // erase the value of h; false if h is stale or null:
+
+    bool erase( handle_type h )
+    {
+        if ( ! contains( h ) )
+            return false;
+
+        word const s    = h.index();
+        word const pos  = slots[s].position;
+        word const last = static_cast<word>( values.size() - 1 );
+
+        if ( pos != last )
+        {
+            values[pos] = std::move( values[last] );
+            owners[pos] = owners[last];
+            slots[ owners[pos] ].position = pos;
+        }
+        values.pop_back();
+        owners.pop_back();
+
+        release_slot( s );
+        return true;
+    }
+
+    bool contains( handle_type h ) const
+    {
+        return h.index() < slots.size() && slots[ h.index() ].generation == h.generation() && ! h.is_null();
+    }
+
+    // the value of h, or nullptr if h is stale or null:
+
+    T * find( handle_type h )
+    {
+        return contains( h ) ? &values[ slots[ h.index() ].position ] : nullptr;
+    }
+
+    T const * find( handle_type h ) const
+    {
+        return contains( h ) ? &values[ slots[ h.index() ].position ] : nullptr;
+    }
+
+    T & operator[]( handle_type h )
+    {
+        assert( contains( h ) && "slot_map: stale or null handle" );
+        return values[ slots[ h.index() ].position ];
+    }
+
+    T const & operator[]( handle_type h ) const
+    {
+        assert( contains( h ) && "slot_map: stale or null handle" );
+        return values[ slots[ h.index() ].position ];
+    }
+
+    // the handle of the value at dense position pos:
+
+    handle_type handle_at( size_type pos ) const
+    {
+        assert( pos < size() );
+        return handle_type( owners[pos], slots[ owners[pos] ].generation );
+    }
+
+    // dense iteration:
+
+    iterator       begin()       type_noexcept { return values.begin(); }
+    iterator       end()         type_noexcept { return values.end(); }
+    const_iterator begin() const type_noexcept { return values.begin(); }
+    const_iterator end()   const type_noexcept { return values.end(); }
+
+    T       * data()       type_noexcept { return values.data(); }
+    T const * data() const type_noexcept { return values.data(); }
+
+    size_type size()  const type_noexcept { return values.size(); }
+    bool      empty() const type_noexcept { return values.empty(); }
+
+    void reserve( size_type n )
+    {
+        values.reserve( n );
+        owners.reserve( n );
+        slots.reserve( n );
+    }
+
+    // erase all values, invalidating all handles:
+
+    void clear()
+    {
+        for ( word s : owners )
+            release_slot( s );
+
+        values.clear();
+        owners.clear();
+    }
+
+private:
+    typedef typename handle_type::word_type word;
+
+    struct slot
+    {
+        word generation;    // 0: retired
+        word position;      // live: position in values, free: next free slot
+    };
+
+    static type_constexpr word no_slot() { return static_cast<word>( ~word(0) ); }
+
+    // no free slot and no index left for a fresh one:
+
+    bool full() const
+    {
+        return free_head == no_slot() && slots.size() > handle_type::max_index();
+    }
+
+    // grow geometrically, so that the next push_back() cannot throw:
+
+    template< typename V >
+    static void make_room_for_one( std::vector<V> & v )
+    {
+        if ( v.size() == v.capacity() )
+            v.reserve( v.empty() ? 1 : 2 * v.size() );
+    }
+
+    word acquire_slot()
+    {
+        if ( free_head != no_slot() )
+        {
+            word const s = free_head;
+            free_head = slots[s].position;
+            return s;
+        }
+
+        slot const fresh = { 1u, 0u };
+        slots.push_back( fresh );
+        return static_cast<word>( slots.size() - 1 );
+    }
+
+    void release_slot( word s )
+    {
+        if ( slots[s].generation == handle_type::max_generation() )
+        {
+            slots[s].generation = 0u;
+            return;
+        }
+
+        ++slots[s].generation;
+        slots[s].position = free_head;
+        free_head = s;
+    }
+
+private:
+    std::vector<slot> slots;
+    std::vector<T>    values;
+    std::vector<word> owners;   // slot per position in values
+    word              free_head;
+};
+
+}}  // namespace nonstd::types
+
+// make slot_map available in namespace nonstd:
+
+namespace nonstd {
+
+using types::slot_map;
+
+} // namespace nonstd
+
+#endif // type_CPP11_OR_GREATER
+
+#endif // NONSTD_TYPE_SLOT_MAP_HPP_INCLUDED
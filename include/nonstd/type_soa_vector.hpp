@@ -0,0 +1,402 @@
+// Copyright 2018-2022 Martin Moene
+//
+// type-lite, strong types for C++98 and later.
+// For more information see https://github.com/martinmoene/type-lite
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef NONSTD_TYPE_SOA_VECTOR_HPP_INCLUDED
+#define NONSTD_TYPE_SOA_VECTOR_HPP_INCLUDED
+
+#include "type.hpp"
+
+#if type_CPP11_OR_GREATER
+
+#include <cassert>
+#include <cstddef>          // std::size_t, std::ptrdiff_t
+#include <iterator>         // std::random_access_iterator_tag
+#include <tuple>
+#include <type_traits>      // std::integral_constant<>
+#include <vector>
+
+namespace nonstd { namespace types {
+
+namespace detail {
+
+// number of occurrences of T in Ts...:
+
+template< typename T, typename... Ts >
+struct soa_count : std::integral_constant<std::size_t, 0> {};
+
+template< typename T, typename U, typename... Ts >
+struct soa_count<T, U, Ts...> : std::integral_constant<std::size_t, std::is_same<T,U>::value + soa_count<T, Ts...>::value> {};
+
+// position of T in Ts...:
+
+template< typename T, typename... Ts >
+struct soa_index;
+
+template< typename T, typename... Ts >
+struct soa_index<T, T, Ts...> : std::integral_constant<std::size_t, 0> {};
+
+template< typename T, typename U, typename... Ts >
+struct soa_index<T, U, Ts...> : std::integral_constant<std::size_t, 1 + soa_index<T, Ts...>::value> {};
+
+// swallow the results of a pack expansion:
+
+template< typename... Ts >
+inline void soa_each( Ts &&... ) {}
+
+// true if all field types are distinct:
+
+template< typename... Ts >
+struct soa_distinct;
+
+template<>
+struct soa_distinct<> : std::true_type {};
+
+template< typename T, typename... Ts >
+struct soa_distinct<T, Ts...> : std::integral_constant<bool, soa_count<T, Ts...>::value == 0 && soa_distinct<Ts...>::value> {};
+
+// index sequence (C++11):
+
+template< std::size_t... Is > struct soa_indices {};
+
+template< std::size_t N, std::size_t... Is >
+struct soa_make_indices : soa_make_indices<N - 1, N - 1, Is...> {};
+
+template< std::size_t... Is >
+struct soa_make_indices<0, Is...> { typedef soa_indices<Is...> type; };
+
+} // namespace detail
+
+template< typename SoA, bool Const >
+class soa_row;
+
+template< typename SoA, bool Const >
+class soa_iterator;
+
+/**
+ * soa_vector, structure-of-arrays sequence of records whose fields are
+ * distinct strong types.
+ *
+ * Each field is stored in its own contiguous array, so that scanning one
+ * field only touches the memory of that field. Fields are selected by
+ * type, for example column<Price>() and get<Price>(i); operator[] yields
+ * a row proxy that gives access to the fields of one record.
+ */
+template< typename... Fields >
+class soa_vector
+{
+public:
+    static_assert( sizeof...(Fields) > 0, "soa_vector: requires at least one field" );
+    static_assert( detail::soa_distinct<Fields...>::value, "soa_vector: field types must be distinct" );
+
+    typedef std::tuple<Fields...>                   value_type;
+    typedef std::size_t                             size_type;
+    typedef std::ptrdiff_t                          difference_type;
+    typedef soa_row<soa_vector, false>              reference;
+    typedef soa_row<soa_vector, true >              const_reference;
+    typedef soa_iterator<soa_vector, false>         iterator;
+    typedef soa_iterator<soa_vector, true >         const_iterator;
+
+    template< typename F >
+    struct has_field : std::integral_constant<bool, detail::soa_count<F, Fields...>::value == 1> {};
+
+    soa_vector() {}
+
+    explicit soa_vector( size_type n )
+        : columns( std::vector<Fields>( n )... )
+    {}
+
+    // the array of field F:
+
+    template< typename F >
+    F * data() type_noexcept
+    {
+        return column_vector<F>().data();
+    }
+
+    template< typename F >
+    F const * data() const type_noexcept
+    {
+        return column_vector<F>().data();
+    }
+
+    template< typename F >
+    std::vector<F> const & column() const type_noexcept
+    {
+        return column_vector<F>();
+    }
+
+    // field F of record pos:
+
+    template< typename F >
+    F & get( size_type pos )
+    {
+        assert( pos < size() );
+        return column_vector<F>()[ pos ];
+    }
+
+    template< typename F >
+    F const & get( size_type pos ) const
+    {
+        assert( pos < size() );
+        return column_vector<F>()[ pos ];
+    }
+
+    reference       operator[]( size_type pos )       { return reference      ( this, pos ); }
+    const_reference operator[]( size_type pos ) const { return const_reference( this, pos ); }
+
+    iterator       begin()       { return iterator      ( this, 0 ); }
+    iterator       end()         { return iterator      ( this, size() ); }
+    const_iterator begin() const { return const_iterator( this, 0 ); }
+    const_iterator end()   const { return const_iterator( this, size() ); }
+
+    void push_back( Fields const &... fields )
+    {
+        push_back_( typename detail::soa_make_indices<sizeof...(Fields)>::type(), fields... );
+    }
+
+    void push_back( value_type const & record )
+    {
+        push_back_tuple( typename detail::soa_make_indices<sizeof...(Fields)>::type(), record );
+    }
+
+    void reserve( size_type n )
+    {
+        reserve_( typename detail::soa_make_indices<sizeof...(Fields)>::type(), n );
+    }
+
+    void resize( size_type n )
+    {
+        resize_( typename detail::soa_make_indices<sizeof...(Fields)>::type(), n );
+    }
+
+    void clear()
+    {
+        clear_( typename detail::soa_make_indices<sizeof...(Fields)>::type() );
+    }
+
+    size_type size()  const type_noexcept { return std::get<0>( columns ).size(); }
+    bool      empty() const type_noexcept { return size() == 0; }
+
+    // the record at pos as a tuple of its fields:
+
+    value_type record( size_type pos ) const
+    {
+        return record_( typename detail::soa_make_indices<sizeof...(Fields)>::type(), pos );
+    }
+
+    void assign( size_type pos, value_type const & v )
+    {
+        assign_( typename detail::soa_make_indices<sizeof...(Fields)>::type(), pos, v );
+    }
+
+private:
+    template< typename F >
+    std::vector<F> & column_vector() type_noexcept
+    {
+        static_assert( has_field<F>::value, "soa_vector: no such field" );
+        return std::get< detail::soa_index<F, Fields...>::value >( columns );
+    }
+
+    template< typename F >
+    std::vector<F> const & column_vector() const type_noexcept
+    {
+        static_assert( has_field<F>::value, "soa_vector: no such field" );
+        return std::get< detail::soa_index<F, Fields...>::value >( columns );
+    }
+
+    // append to all columns, or to none if a push_back throws:
+
+    template< std::size_t... Is >
+    void push_back_( detail::soa_indices<Is...>, Fields const &... fields )
+    {
+        size_type const n = size();
+
+        try
+        {
+            detail::soa_each( ( std::get<Is>( columns ).push_back( fields ), 0 )... );
+        }
+        catch ( ... )
+        {
+            truncate_( detail::soa_indices<Is...>(), n );
+            throw;
+        }
+    }
+
+    template< std::size_t... Is >
+    void push_back_tuple( detail::soa_indices<Is...> is, value_type const & record )
+    {
+        push_back_( is, std::get<Is>( record )... );
+    }
+
+    // pop the columns that are longer than n, also for fields that are not
+    // default-constructible:
+
+    template< std::size_t... Is >
+    void truncate_( detail::soa_indices<Is...>, size_type n ) type_noexcept
+    {
+        detail::soa_each( ( std::get<Is>( columns ).size() > n ? std::get<Is>( columns ).pop_back() : void(), 0 )... );
+    }
+
+    template< std::size_t... Is >
+    void reserve_( detail::soa_indices<Is...>, size_type n )
+    {
+        detail::soa_each( ( std::get<Is>( columns ).reserve( n ), 0 )... );
+    }
+
+    template< std::size_t... Is >
+    void resize_( detail::soa_indices<Is...>, size_type n )
+    {
+        detail::soa_each( ( std::get<Is>( columns ).resize( n ), 0 )... );
+    }
+
+    template< std::size_t... Is >
+    void clear_( detail::soa_indices<Is...> )
+    {
+        detail::soa_each( ( std::get<Is>( columns ).clear(), 0 )... );
+    }
+
+    template< std::size_t... Is >
+    value_type record_( detail::soa_indices<Is...>, size_type pos ) const
+    {
+        return value_type( std::get<Is>( columns )[ pos ]... );
+    }
+
+    template< std::size_t... Is >
+    void assign_( detail::soa_indices<Is...>, size_type pos, value_type const & v )
+    {
+        detail::soa_each( ( std::get<Is>( columns )[ pos ] = std::get<Is>( v ), 0 )... );
+    }
+
+private:
+    std::tuple< std::vector<Fields>... > columns;
+};
+
+/**
+ * proxy to a record of a soa_vector, giving access to its fields by type.
+ */
+template< typename SoA, bool Const >
+class soa_row
+{
+public:
+    typedef typename std::conditional<Const, SoA const, SoA>::type  container_type;
+    typedef typename SoA::value_type                                value_type;
+    typedef typename SoA::size_type                                 size_type;
+
+    soa_row( container_type * soa_, size_type pos_ )
+        : soa( soa_ ), pos( pos_ )
+    {}
+
+    soa_row( soa_row const & ) = default;
+
+    template< typename F >
+    auto get() const -> decltype( std::declval<container_type &>().template get<F>( size_type() ) )
+    {
+        return soa->template get<F>( pos );
+    }
+
+    operator value_type() const
+    {
+        return soa->record( pos );
+    }
+
+    soa_row const & operator=( value_type const & v ) const
+    {
+        soa->assign( pos, v );
+        return *this;
+    }
+
+    soa_row const & operator=( soa_row const & other ) const
+    {
+        return *this = value_type( other );
+    }
+
+    size_type index() const { return pos; }
+
+    // field F of the record, get<F>(row), found via argument-dependent lookup;
+    // before C++20 that requires a function template get in scope, such as
+    // via using std::get:
+
+    template< typename F >
+    friend auto get( soa_row const & row ) -> decltype( row.template get<F>() )
+    {
+        return row.template get<F>();
+    }
+
+private:
+    container_type * soa;
+    size_type pos;
+};
+
+/**
+ * iterator over the records of a soa_vector, yielding row proxies.
+ */
+template< typename SoA, bool Const >
+class soa_iterator
+{
+public:
+    typedef std::random_access_iterator_tag                         iterator_category;
+    typedef typename SoA::value_type                                value_type;
+    typedef std::ptrdiff_t                                          difference_type;
+    typedef soa_row<SoA, Const>                                     reference;
+    typedef void                                                    pointer;
+    typedef typename std::conditional<Const, SoA const, SoA>::type  container_type;
+
+    soa_iterator()
+        : soa( nullptr ), pos( 0 )
+    {}
+
+    soa_iterator( container_type * soa_, std::size_t pos_ )
+        : soa( soa_ ), pos( pos_ )
+    {}
+
+    reference operator*() const { return reference( soa, pos ); }
+    reference operator[]( difference_type n ) const { return reference( soa, pos + static_cast<std::size_t>( n ) ); }
+
+    soa_iterator & operator++() { ++pos; return *this; }
+    soa_iterator & operator--() { --pos; return *this; }
+
+    soa_iterator   operator++( int ) { soa_iterator tmp(*this); ++pos; return tmp; }
+    soa_iterator   operator--( int ) { soa_iterator tmp(*this); --pos; return tmp; }
+
+    soa_iterator & operator+=( difference_type n ) { pos = static_cast<std::size_t>( static_cast<difference_type>( pos ) + n ); return *this; }
+    soa_iterator & operator-=( difference_type n ) { pos = static_cast<std::size_t>( static_cast<difference_type>( pos ) - n ); return *this; }
+
+    friend soa_iterator operator+( soa_iterator x, difference_type n ) { return x += n; }
+    friend soa_iterator operator+( difference_type n, soa_iterator x ) { return x += n; }
+    friend soa_iterator operator-( soa_iterator x, difference_type n ) { return x -= n; }
+
+    friend difference_type operator-( soa_iterator const & x, soa_iterator const & y )
+    {
+        return static_cast<difference_type>( x.pos ) - static_cast<difference_type>( y.pos );
+    }
+
+    friend bool operator==( soa_iterator const & x, soa_iterator const & y ) { return x.pos == y.pos; }
+    friend bool operator!=( soa_iterator const & x, soa_iterator const & y ) { return x.pos != y.pos; }
+    friend bool operator< ( soa_iterator const & x, soa_iterator const & y ) { return x.pos <  y.pos; }
+    friend bool operator> ( soa_iterator const & x, soa_iterator const & y ) { return y.pos <  x.pos; }
+    friend bool operator<=( soa_iterator const & x, soa_iterator const & y ) { return !( y.pos < x.pos ); }
+    friend bool operator>=( soa_iterator const & x, soa_iterator const & y ) { return !( x.pos < y.pos ); }
+
+private:
+    container_type * soa;
+    std::size_t pos;
+};
+
+}}  // namespace nonstd::types
+
+// make soa_vector available in namespace nonstd:
+
+namespace nonstd {
+
+using types::soa_vector;
+
+} // namespace nonstd
+
+#endif // type_CPP11_OR_GREATER
+
+#endif // NONSTD_TYPE_SOA_VECTOR_HPP_INCLUDED
@@ -0,0 +1,44 @@
+// Copyright 2018-2022 Martin Moene
+//
+// type-lite, strong types for C++98 and later.
+// For more information see https://github.com/martinmoene/type-lite
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Stream input and output of strong types as their underlying value.
+//
+// Not included by nonstd/type.hpp. Do not combine with a user-defined
+// operator<<() for nonstd::type<T,Tag,D>, as that is ambiguous.
+
+#ifndef NONSTD_TYPE_STREAM_HPP_INCLUDED
+#define NONSTD_TYPE_STREAM_HPP_INCLUDED
+
+#include "type.hpp"
+
+#include <istream>
+#include <ostream>
+
+namespace nonstd { namespace types {
+
+/**
+ * write the underlying value.
+ */
+template< typename CharT, typename Traits, typename T, typename Tag, typename D >
+inline std::basic_ostream<CharT,Traits> & operator<<( std::basic_ostream<CharT,Traits> & os, type<T,Tag,D> const & v )
+{
+    return os << v.get();
+}
+
+/**
+ * read the underlying value.
+ */
+template< typename CharT, typename Traits, typename T, typename Tag, typename D >
+inline std::basic_istream<CharT,Traits> & operator>>( std::basic_istream<CharT,Traits> & is, type<T,Tag,D> & v )
+{
+    return is >> v.get();
+}
+
+}}  // namespace nonstd::types
+
+#endif // NONSTD_TYPE_STREAM_HPP_INCLUDED
@@ -0,0 +1,253 @@
+// Copyright 2018-2022 Martin Moene
+//
+// type-lite, strong types for C++98 and later.
+// For more information see https://github.com/martinmoene/type-lite
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef NONSTD_TYPE_STRONG_HPP_INCLUDED
+#define NONSTD_TYPE_STRONG_HPP_INCLUDED
+
+#include "type.hpp"
+
+#if type_CPP11_OR_GREATER
+
+#include <type_traits>      // std::is_base_of<>
+#include <utility>          // std::move()
+
+namespace nonstd { namespace types {
+
+template< typename T, typename Tag, template< typename > class... Skills >
+struct strong;
+
+namespace detail {
+
+// underlying type of strong type R, available while R is still incomplete:
+
+template< typename R >
+struct skill_value;
+
+template< typename T, typename Tag, template< typename > class... Skills >
+struct skill_value< strong<T,Tag,Skills...> >
+{
+    typedef T type;
+};
+
+} // namespace detail
+
+/**
+ * skills of strong<T,Tag,Skills...>, each providing a group of operators
+ * for strong type R, implemented directly on the underlying values.
+ */
+namespace skill {
+
+/**
+ * ==, !=
+ */
+template< typename R >
+struct equality
+{
+    friend type_constexpr14 bool operator==( R const & x, R const & y ) { type_COUNT_OPERATION( R, op_eq ); return x.get() == y.get(); }
+    friend type_constexpr14 bool operator!=( R const & x, R const & y ) { type_COUNT_OPERATION( R, op_ne ); return x.get() != y.get(); }
+};
+
+/**
+ * <, <=, >, >= and, with C++20, <=>; does not imply equality.
+ */
+template< typename R >
+struct ordered
+{
+    friend type_constexpr14 bool operator< ( R const & x, R const & y ) { type_COUNT_OPERATION( R, op_lt ); return x.get() <  y.get(); }
+    friend type_constexpr14 bool operator<=( R const & x, R const & y ) { type_COUNT_OPERATION( R, op_le ); return x.get() <= y.get(); }
+    friend type_constexpr14 bool operator> ( R const & x, R const & y ) { type_COUNT_OPERATION( R, op_gt ); return x.get() >  y.get(); }
+    friend type_constexpr14 bool operator>=( R const & x, R const & y ) { type_COUNT_OPERATION( R, op_ge ); return x.get() >= y.get(); }
+
+#if type_HAVE_THREE_WAY_COMPARISON
+    friend constexpr auto operator<=>( R const & x, R const & y ) requires std::three_way_comparable< typename R::underlying_type > { type_COUNT_OPERATION( R, op_cmp ); return x.get() <=> y.get(); }
+#endif
+};
+
+/**
+ * x + y, x += y, +x
+ */
+template< typename R >
+struct addition
+{
+    friend type_constexpr14 R   operator+ ( R x, R const & y ) { type_COUNT_OPERATION( R, op_add ); x.get() += y.get(); return x; }
+    friend type_constexpr14 R & operator+=( R & x, R const & y ) { x.get() += y.get(); return x; }
+    friend type_constexpr14 R   operator+ ( R const & x ) { return x; }
+};
+
+/**
+ * x - y, x -= y
+ */
+template< typename R >
+struct subtraction
+{
+    friend type_constexpr14 R   operator- ( R x, R const & y ) { type_COUNT_OPERATION( R, op_sub ); x.get() -= y.get(); return x; }
+    friend type_constexpr14 R & operator-=( R & x, R const & y ) { x.get() -= y.get(); return x; }
+};
+
+/**
+ * -x
+ */
+template< typename R >
+struct negation
+{
+    friend type_constexpr14 R operator-( R const & x ) { return R( -x.get() ); }
+};
+
+/**
+ * x * y, x *= y
+ */
+template< typename R >
+struct multiplication
+{
+    friend type_constexpr14 R   operator* ( R x, R const & y ) { type_COUNT_OPERATION( R, op_mul ); x.get() *= y.get(); return x; }
+    friend type_constexpr14 R & operator*=( R & x, R const & y ) { x.get() *= y.get(); return x; }
+};
+
+/**
+ * x / y, x /= y
+ */
+template< typename R >
+struct division
+{
+    friend type_constexpr14 R   operator/ ( R x, R const & y ) { type_COUNT_OPERATION( R, op_div ); x.get() /= y.get(); return x; }
+    friend type_constexpr14 R & operator/=( R & x, R const & y ) { x.get() /= y.get(); return x; }
+};
+
+/**
+ * x % y, x %= y
+ */
+template< typename R >
+struct modulus
+{
+    friend type_constexpr14 R   operator% ( R x, R const & y ) { type_COUNT_OPERATION( R, op_mod ); x.get() %= y.get(); return x; }
+    friend type_constexpr14 R & operator%=( R & x, R const & y ) { x.get() %= y.get(); return x; }
+};
+
+/**
+ * x * v, v * x, x / v, x *= v, x /= v, x / y => underlying value, as quantity.
+ */
+template< typename R >
+struct scaling
+{
+    typedef typename detail::skill_value<R>::type T;
+
+    friend type_constexpr14 R   operator* ( R x, T const & v ) { type_COUNT_OPERATION( R, op_mul ); x.get() *= v; return x; }
+    friend type_constexpr14 R   operator* ( T const & v, R x ) { type_COUNT_OPERATION( R, op_mul ); x.get() *= v; return x; }
+    friend type_constexpr14 R   operator/ ( R x, T const & v ) { type_COUNT_OPERATION( R, op_div ); x.get() /= v; return x; }
+    friend type_constexpr14 R & operator*=( R & x, T const & v ) { x.get() *= v; return x; }
+    friend type_constexpr14 R & operator/=( R & x, T const & v ) { x.get() /= v; return x; }
+    friend type_constexpr14 T   operator/ ( R const & x, R const & y ) { type_COUNT_OPERATION( R, op_div ); return x.get() / y.get(); }
+};
+
+/**
+ * ++x, --x, x++, x--
+ */
+template< typename R >
+struct increment
+{
+    friend type_constexpr14 R & operator++( R & x ) { ++x.get(); return x; }
+    friend type_constexpr14 R & operator--( R & x ) { --x.get(); return x; }
+    friend type_constexpr14 R   operator++( R & x, int ) { R tmp( x ); ++x.get(); return tmp; }
+    friend type_constexpr14 R   operator--( R & x, int ) { R tmp( x ); --x.get(); return tmp; }
+};
+
+/**
+ * ~x, x & y, x | y, x ^ y, x &= y, x |= y, x ^= y
+ */
+template< typename R >
+struct bitwise
+{
+    friend type_constexpr14 R   operator~ ( R const & x ) { return R( static_cast<typename R::underlying_type>( ~x.get() ) ); }
+    friend type_constexpr14 R   operator& ( R x, R const & y ) { type_COUNT_OPERATION( R, op_bitand ); x.get() &= y.get(); return x; }
+    friend type_constexpr14 R   operator| ( R x, R const & y ) { type_COUNT_OPERATION( R, op_bitor  ); x.get() |= y.get(); return x; }
+    friend type_constexpr14 R   operator^ ( R x, R const & y ) { type_COUNT_OPERATION( R, op_bitxor ); x.get() ^= y.get(); return x; }
+    friend type_constexpr14 R & operator&=( R & x, R const & y ) { x.get() &= y.get(); return x; }
+    friend type_constexpr14 R & operator|=( R & x, R const & y ) { x.get() |= y.get(); return x; }
+    friend type_constexpr14 R & operator^=( R & x, R const & y ) { x.get() ^= y.get(); return x; }
+};
+
+/**
+ * x << n, x >> n, x <<= n, x >>= n
+ */
+template< typename R >
+struct shift
+{
+    friend type_constexpr14 R   operator<< ( R x, int const n ) { type_COUNT_OPERATION( R, op_shl ); x.get() <<= n; return x; }
+    friend type_constexpr14 R   operator>> ( R x, int const n ) { type_COUNT_OPERATION( R, op_shr ); x.get() >>= n; return x; }
+    friend type_constexpr14 R & operator<<=( R & x, int const n ) { x.get() <<= n; return x; }
+    friend type_constexpr14 R & operator>>=( R & x, int const n ) { x.get() >>= n; return x; }
+};
+
+/**
+ * !x, x && y, x || y
+ */
+template< typename R >
+struct logical
+{
+    friend type_constexpr14 R operator! ( R const & x ) { type_COUNT_OPERATION( R, op_not ); return R( ! x.get() ); }
+    friend type_constexpr14 R operator&&( R const & x, R const & y ) { type_COUNT_OPERATION( R, op_and ); return R( x.get() && y.get() ); }
+    friend type_constexpr14 R operator||( R const & x, R const & y ) { type_COUNT_OPERATION( R, op_or  ); return R( x.get() || y.get() ); }
+};
+
+} // namespace skill
+
+/**
+ * strong, strong type with exactly the operators of the given skills.
+ *
+ * The skills are direct bases, so that a strong type only instantiates its
+ * own class, its type<T,Tag,T> base and one class per skill, for example:
+ *
+ *   typedef strong<int, struct MeterTag, skill::equality, skill::ordered, skill::addition> Meter;
+ *
+ * As it derives from type<T,Tag,T>, to_value(), swap(), make_hash() and the
+ * concepts apply, and it converts explicitly from and to the family types
+ * with the same underlying type and tag.
+ */
+template< typename T, typename Tag, template< typename > class... Skills >
+struct strong
+    : type< T,Tag,T >
+    , Skills< strong<T,Tag,Skills...> >...
+{
+    type_constexpr strong()
+        : type<T,Tag,T>()
+    {}
+
+    type_constexpr explicit strong( T v )
+        : type<T,Tag,T>( std::move(v) )
+    {}
+
+    // from a family type with the same underlying type and tag:
+
+    type_constexpr explicit strong( type<T,Tag,T> const & other )
+        : type<T,Tag,T>( other )
+    {}
+
+    // to a family type with the same underlying type and tag:
+
+    template< typename F type_REQUIRES_T( std::is_base_of< type<T,Tag,T>, F >::value ) >
+    type_constexpr explicit operator F() const
+    {
+        return F( this->get() );
+    }
+};
+
+}}  // namespace nonstd::types
+
+// make strong and its skills available in namespace nonstd:
+
+namespace nonstd {
+
+using types::strong;
+
+namespace skill = types::skill;
+
+} // namespace nonstd
+
+#endif // type_CPP11_OR_GREATER
+
+#endif // NONSTD_TYPE_STRONG_HPP_INCLUDED
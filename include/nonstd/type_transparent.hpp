@@ -0,0 +1,149 @@
+// Copyright 2018-2022 Martin Moene
+//
+// type-lite, strong types for C++98 and later.
+// For more information see https://github.com/martinmoene/type-lite
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef NONSTD_TYPE_TRANSPARENT_HPP_INCLUDED
+#define NONSTD_TYPE_TRANSPARENT_HPP_INCLUDED
+
+#include "type.hpp"
+
+#if type_CPP11_OR_GREATER
+
+#include <cstddef>          // std::size_t
+#include <functional>       // std::hash<>
+#include <type_traits>      // std::is_same<>, std::conditional<>
+#include <utility>          // std::declval()
+
+#if type_CPP17_OR_GREATER
+# include <string>
+# include <string_view>
+#endif
+
+namespace nonstd { namespace types {
+
+namespace detail {
+
+// the tag of a strong type, declaration only:
+
+template< typename T, typename Tag, typename D >
+Tag transparent_tag( type<T,Tag,D> const * );
+
+template< typename S >
+using transparent_tag_of = decltype( transparent_tag( static_cast<S const *>( nullptr ) ) );
+
+// true if S supports x < y:
+
+template< typename S, typename = void >
+struct transparent_has_less : std::false_type {};
+
+template< typename S >
+struct transparent_has_less< S, typename std::enable_if< std::is_convertible< decltype( std::declval<S const &>() < std::declval<S const &>() ), bool >::value >::type > : std::true_type {};
+
+} // namespace detail
+
+/**
+ * strong_view, the non-owning view type of owning strong type S, with the
+ * tag of S, as member type; used for heterogeneous lookup.
+ *
+ * Provided for a family with a std::basic_string<> underlying type, such as
+ * equality<std::string,Tag>, as the same family with std::basic_string_view<>
+ * (C++17). Specialize it for other owning types.
+ */
+template< typename S >
+struct strong_view {};
+
+#if type_CPP17_OR_GREATER
+
+template< template< typename, typename, typename > class Family, typename C, typename Tr, typename A, typename Tag, typename D >
+struct strong_view< Family< std::basic_string<C,Tr,A>, Tag, D > >
+{
+    typedef std::basic_string_view<C,Tr> view_type;
+
+    typedef Family< view_type, Tag, typename std::conditional< std::is_same< D, std::basic_string<C,Tr,A> >::value, view_type, D >::type > type;
+};
+
+#endif // type_CPP17_OR_GREATER
+
+/**
+ * transparent_hash, hash of owning strong type S and of its view type V
+ * that yields the same value for an owning value and its view, for
+ * heterogeneous lookup in unordered containers (C++20), for example:
+ *
+ *   typedef equality<std::string, struct UserTag> User;
+ *   std::unordered_map< User, int, transparent_hash<User>, transparent_equal_to<User> > users;
+ *   users.find( strong_view<User>::type( name ) );   // no User constructed
+ */
+template< typename S, typename V = typename strong_view<S>::type >
+struct transparent_hash
+{
+    static_assert( std::is_same< detail::transparent_tag_of<S>, detail::transparent_tag_of<V> >::value, "transparent_hash: view type must have the tag of the strong type" );
+
+    typedef void is_transparent;
+
+    std::size_t operator()( S const & x ) const { return std::hash<view>()( view( x.get() ) ); }
+    std::size_t operator()( V const & x ) const { return std::hash<view>()( x.get() ); }
+
+private:
+    typedef typename V::underlying_type view;
+};
+
+/**
+ * transparent_equal_to, == among owning strong type S and its view type V.
+ */
+template< typename S, typename V = typename strong_view<S>::type >
+struct transparent_equal_to
+{
+    static_assert( std::is_same< detail::transparent_tag_of<S>, detail::transparent_tag_of<V> >::value, "transparent_equal_to: view type must have the tag of the strong type" );
+
+    typedef void is_transparent;
+
+    bool operator()( S const & x, S const & y ) const { return x.get() == y.get(); }
+    bool operator()( S const & x, V const & y ) const { return view( x.get() ) == y.get(); }
+    bool operator()( V const & x, S const & y ) const { return x.get() == view( y.get() ); }
+    bool operator()( V const & x, V const & y ) const { return x.get() == y.get(); }
+
+private:
+    typedef typename V::underlying_type view;
+};
+
+/**
+ * transparent_less, < among owning ordered strong type S and its view type
+ * V, for heterogeneous lookup in ordered containers (C++14).
+ */
+template< typename S, typename V = typename strong_view<S>::type >
+struct transparent_less
+{
+    static_assert( std::is_same< detail::transparent_tag_of<S>, detail::transparent_tag_of<V> >::value, "transparent_less: view type must have the tag of the strong type" );
+    static_assert( detail::transparent_has_less<S>::value, "transparent_less: strong type must provide operator<" );
+
+    typedef void is_transparent;
+
+    bool operator()( S const & x, S const & y ) const { return x.get() < y.get(); }
+    bool operator()( S const & x, V const & y ) const { return view( x.get() ) < y.get(); }
+    bool operator()( V const & x, S const & y ) const { return x.get() < view( y.get() ); }
+    bool operator()( V const & x, V const & y ) const { return x.get() < y.get(); }
+
+private:
+    typedef typename V::underlying_type view;
+};
+
+}}  // namespace nonstd::types
+
+// make the transparent functors available in namespace nonstd:
+
+namespace nonstd {
+
+using types::strong_view;
+using types::transparent_hash;
+using types::transparent_equal_to;
+using types::transparent_less;
+
+} // namespace nonstd
+
+#endif // type_CPP11_OR_GREATER
+
+#endif // NONSTD_TYPE_TRANSPARENT_HPP_INCLUDED
@@ -0,0 +1,162 @@
+// Copyright 2018-2022 Martin Moene
+//
+// type-lite, strong types for C++98 and later.
+// For more information see https://github.com/martinmoene/type-lite
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef NONSTD_TYPE_TSC_HPP_INCLUDED
+#define NONSTD_TYPE_TSC_HPP_INCLUDED
+
+#include "type.hpp"
+
+#if type_CPP11_OR_GREATER
+
+#include <chrono>
+#include <cstdint>
+
+// CPU cycle counter available:
+
+#if defined( __x86_64__ ) || defined( __i386__ ) || defined( _M_X64 ) || defined( _M_IX86 )
+# define type_HAVE_TSC_COUNTER  1
+#elif defined( __aarch64__ ) && ( defined( __GNUC__ ) || defined( __clang__ ) )
+# define type_HAVE_TSC_COUNTER  1
+#else
+# define type_HAVE_TSC_COUNTER  0
+#endif
+
+// Read the CPU cycle counter if available, 0: std::chrono::steady_clock in nanoseconds:
+
+#ifndef  type_CONFIG_TSC_COUNTER
+# define type_CONFIG_TSC_COUNTER  type_HAVE_TSC_COUNTER
+#endif
+
+#if type_CONFIG_TSC_COUNTER && ! type_HAVE_TSC_COUNTER
+# error type-lite: type_CONFIG_TSC_COUNTER requires a CPU cycle counter (x86, AArch64)
+#endif
+
+#if type_CONFIG_TSC_COUNTER
+# if defined( _MSC_VER )
+#  include <intrin.h>
+# elif defined( __x86_64__ ) || defined( __i386__ )
+#  include <x86intrin.h>
+# endif
+#endif
+
+namespace nonstd { namespace types {
+
+/**
+ * tag of the time-stamp counter types.
+ */
+struct tsc_tag{};
+
+/**
+ * tsc_duration, a difference of time-stamp counter readings in ticks.
+ */
+typedef offset< std::int64_t, tsc_tag > tsc_duration;
+
+/**
+ * tsc_point, a time-stamp counter reading:
+ *
+ * tsc_point - tsc_point => tsc_duration
+ * tsc_point + tsc_duration => tsc_point
+ */
+typedef address< std::int64_t, std::int64_t, tsc_tag > tsc_point;
+
+namespace detail {
+
+inline std::int64_t tsc_read()
+{
+#if type_CONFIG_TSC_COUNTER
+# if defined( __aarch64__ )
+    std::uint64_t ticks;
+    asm volatile( "mrs %0, cntvct_el0" : "=r"( ticks ) );
+    return static_cast<std::int64_t>( ticks );
+# else
+    return static_cast<std::int64_t>( __rdtsc() );
+# endif
+#else
+    return static_cast<std::int64_t>( std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch() ).count() );
+#endif
+}
+
+// ticks per nanosecond, measured against std::chrono::steady_clock over interval:
+
+inline double tsc_measure( std::chrono::nanoseconds interval )
+{
+#if type_CONFIG_TSC_COUNTER
+    typedef std::chrono::steady_clock clock;
+
+    clock::time_point const t0 = clock::now();
+    std::int64_t      const c0 = tsc_read();
+
+    clock::time_point t1 = clock::now();
+    while ( t1 - t0 < interval )
+        t1 = clock::now();
+
+    std::int64_t const c1 = tsc_read();
+
+    return double( c1 - c0 ) / double( std::chrono::duration_cast<std::chrono::nanoseconds>( t1 - t0 ).count() );
+#else
+    return (void) interval, 1.0;
+#endif
+}
+
+} // namespace detail
+
+/**
+ * the current time-stamp counter reading; not ordered with respect to
+ * surrounding instructions. Without a counter, steady_clock nanoseconds.
+ */
+inline tsc_point tsc_now()
+{
+    return tsc_point( detail::tsc_read() );
+}
+
+/**
+ * the number of ticks per nanosecond, calibrated against steady_clock on
+ * the first call, which takes 10 ms; call it at startup to calibrate there.
+ */
+inline double tsc_ticks_per_ns()
+{
+    static double const ticks_per_ns = detail::tsc_measure( std::chrono::milliseconds( 10 ) );
+    return ticks_per_ns;
+}
+
+/**
+ * a duration in ticks converted to nanoseconds, for reporting.
+ */
+inline double to_nanoseconds( tsc_duration d )
+{
+    return double( d.get() ) / tsc_ticks_per_ns();
+}
+
+/**
+ * a duration in ticks converted to a std::chrono duration, for reporting.
+ */
+inline std::chrono::duration<double, std::nano> to_duration( tsc_duration d )
+{
+    return std::chrono::duration<double, std::nano>( to_nanoseconds( d ) );
+}
+
+}}  // namespace nonstd::types
+
+// make the time-stamp counter types available in namespace nonstd:
+
+namespace nonstd {
+
+using types::tsc_tag;
+using types::tsc_duration;
+using types::tsc_point;
+using types::tsc_now;
+using types::tsc_ticks_per_ns;
+using types::to_nanoseconds;
+using types::to_duration;
+
+} // namespace nonstd
+
+#endif // type_CPP11_OR_GREATER
+
+#endif // NONSTD_TYPE_TSC_HPP_INCLUDED
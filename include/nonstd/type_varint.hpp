@@ -0,0 +1,262 @@
+// Copyright 2018-2022 Martin Moene
+//
+// type-lite, strong types for C++98 and later.
+// For more information see https://github.com/martinmoene/type-lite
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef NONSTD_TYPE_VARINT_HPP_INCLUDED
+#define NONSTD_TYPE_VARINT_HPP_INCLUDED
+
+#include "type.hpp"
+
+#if type_CPP11_OR_GREATER
+
+#include <cstddef>          // std::size_t
+#include <cstdint>          // std::uint64_t, std::int64_t
+#include <cstring>          // std::memcpy()
+#include <limits>
+#include <type_traits>      // std::is_integral<>, std::is_signed<>
+#include <vector>
+
+namespace nonstd { namespace types {
+
+/**
+ * maximum number of bytes of a LEB128-encoded 64-bit value.
+ */
+const std::size_t varint_max_bytes = 10;
+
+/**
+ * zigzag mapping of signed to unsigned: 0, -1, 1, -2, ... => 0, 1, 2, 3, ...
+ */
+inline type_constexpr std::uint64_t zigzag_encode( std::int64_t v ) type_noexcept
+{
+    return ( static_cast<std::uint64_t>( v ) << 1 ) ^ static_cast<std::uint64_t>( v >> 63 );
+}
+
+inline type_constexpr std::int64_t zigzag_decode( std::uint64_t v ) type_noexcept
+{
+    return static_cast<std::int64_t>( ( v >> 1 ) ^ ( ~( v & 1 ) + 1 ) );
+}
+
+namespace detail {
+
+template< typename S >
+struct varint_traits
+{
+    typedef typename S::underlying_type underlying_type;
+
+    static_assert( std::is_integral<underlying_type>::value && sizeof(underlying_type) <= 8,
+        "varint: underlying type must be an integer of at most 64 bits" );
+
+    static std::uint64_t to_wire( S const & v ) type_noexcept
+    {
+        return std::is_signed<underlying_type>::value
+            ? zigzag_encode( static_cast<std::int64_t>( to_value( v ) ) )
+            : static_cast<std::uint64_t>( to_value( v ) );
+    }
+
+    // false if wire value is out of range for the underlying type:
+
+    static bool from_wire( std::uint64_t w, S & out ) type_noexcept
+    {
+        if ( std::is_signed<underlying_type>::value )
+        {
+            std::int64_t const v = zigzag_decode( w );
+
+            if ( v < static_cast<std::int64_t>( (std::numeric_limits<underlying_type>::min)() )
+              || v > static_cast<std::int64_t>( (std::numeric_limits<underlying_type>::max)() ) )
+                return false;
+
+            out = S( static_cast<underlying_type>( v ) );
+        }
+        else
+        {
+            if ( w > static_cast<std::uint64_t>( (std::numeric_limits<underlying_type>::max)() ) )
+                return false;
+
+            out = S( static_cast<underlying_type>( w ) );
+        }
+        return true;
+    }
+
+    // single-byte wire value, always in range:
+
+    static S from_wire_byte( unsigned char w ) type_noexcept
+    {
+        return S( static_cast<underlying_type>( std::is_signed<underlying_type>::value
+            ? zigzag_decode( w ) : static_cast<std::int64_t>( w ) ) );
+    }
+};
+
+inline std::size_t varint_put( std::uint64_t w, unsigned char * out ) type_noexcept
+{
+    std::size_t n = 0;
+    while ( w >= 0x80 )
+    {
+        out[n++] = static_cast<unsigned char>( w | 0x80 );
+        w >>= 7;
+    }
+    out[n++] = static_cast<unsigned char>( w );
+    return n;
+}
+
+// nullptr if truncated or longer than 64 bits:
+
+inline unsigned char const * varint_get( unsigned char const * in, unsigned char const * end, std::uint64_t & w ) type_noexcept
+{
+    w = 0;
+    for ( unsigned shift = 0; shift < 64; shift += 7 )
+    {
+        if ( in == end )
+            return nullptr;
+
+        unsigned char const b = *in++;
+
+        if ( shift == 63 && b > 1 )
+            return nullptr;
+
+        w |= static_cast<std::uint64_t>( b & 0x7F ) << shift;
+
+        if ( ( b & 0x80 ) == 0 )
+            return in;
+    }
+    return nullptr;
+}
+
+} // namespace detail
+
+/**
+ * encode strong value as LEB128 varint, zigzag-mapped if signed;
+ * out must have room for varint_max_bytes. Returns the number of bytes written.
+ */
+template< typename S >
+inline std::size_t encode_varint( S const & v, unsigned char * out ) type_noexcept
+{
+    return detail::varint_put( detail::varint_traits<S>::to_wire( v ), out );
+}
+
+/**
+ * decode a varint from [in..end) into strong value out; returns the position
+ * past the varint, or nullptr if the input is malformed or the value does
+ * not fit the underlying type of S.
+ */
+template< typename S >
+inline unsigned char const * decode_varint( unsigned char const * in, unsigned char const * end, S & out ) type_noexcept
+{
+    std::uint64_t w;
+
+    if ( ( in = detail::varint_get( in, end, w ) ) == nullptr )
+        return nullptr;
+
+    return detail::varint_traits<S>::from_wire( w, out ) ? in : nullptr;
+}
+
+/**
+ * varint_array, varint-encoded array of values of strong type S.
+ *
+ * The element type is part of the array's type, so that a payload field
+ * only decodes into its declared strong type.
+ */
+template< typename S >
+class varint_array
+{
+public:
+    typedef S               value_type;
+    typedef std::size_t     size_type;
+
+    varint_array()
+        : count( 0 )
+    {}
+
+    template< typename InputIt >
+    varint_array( InputIt first, InputIt last )
+        : count( 0 )
+    {
+        for ( ; first != last; ++first )
+            push_back( *first );
+    }
+
+    // adopt bytes as received, holding n values:
+
+    varint_array( unsigned char const * first, unsigned char const * last, size_type n )
+        : bytes( first, last )
+        , count( n )
+    {}
+
+    void push_back( S const & v )
+    {
+        unsigned char buf[ varint_max_bytes ];
+        bytes.insert( bytes.end(), buf, buf + encode_varint( v, buf ) );
+        ++count;
+    }
+
+    /**
+     * decode all values into out[0..size()); false if the bytes are malformed.
+     *
+     * Eight bytes at a time are tested for continuation bits; a run of
+     * single-byte varints, the common case for small values, is decoded
+     * without per-byte branching.
+     */
+    bool decode( S * out ) const type_noexcept
+    {
+        unsigned char const * in  = bytes.data();
+        unsigned char const * end = in + bytes.size();
+
+        size_type i = 0;
+
+        while ( i != count )
+        {
+            if ( end - in >= 8 && count - i >= 8 )
+            {
+                std::uint64_t word;
+                std::memcpy( &word, in, 8 );
+
+                if ( ( word & 0x8080808080808080ull ) == 0 )
+                {
+                    for ( unsigned k = 0; k != 8; ++k )
+                        out[i + k] = detail::varint_traits<S>::from_wire_byte( in[k] );
+
+                    in += 8;
+                    i  += 8;
+                    continue;
+                }
+            }
+
+            if ( ( in = decode_varint( in, end, out[i] ) ) == nullptr )
+                return false;
+            ++i;
+        }
+        return in == end;
+    }
+
+    unsigned char const * data() const type_noexcept { return bytes.data(); }
+
+    size_type size()       const type_noexcept { return count; }
+    size_type size_bytes() const type_noexcept { return bytes.size(); }
+    bool      empty()      const type_noexcept { return count == 0; }
+
+private:
+    std::vector<unsigned char> bytes;
+    size_type count;
+};
+
+}}  // namespace nonstd::types
+
+// make varint support available in namespace nonstd:
+
+namespace nonstd {
+
+using types::varint_max_bytes;
+using types::zigzag_encode;
+using types::zigzag_decode;
+using types::encode_varint;
+using types::decode_varint;
+using types::varint_array;
+
+} // namespace nonstd
+
+#endif // type_CPP11_OR_GREATER
+
+#endif // NONSTD_TYPE_VARINT_HPP_INCLUDED
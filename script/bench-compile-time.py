@@ -0,0 +1,256 @@
+#!/usr/bin/env python
+#
+# Copyright 2022-2022 by Martin Moene
+#
+# Distributed under the Boost Software License, Version 1.0.
+# (See accompanying file LICENSE.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+#
+# script/bench-compile-time.py, Python 3.4 and later
+#
+# Compile-time benchmark: generate a number of translation units that each
+# define and use a few strong types, and time compiling them with type-lite
+# as header (#include "nonstd/type.hpp") and as module (import nonstd.type;).
+# The decl-* variants only declare functions with strong types, as a header
+# would, using nonstd/type.hpp, with and without std::hash, or type_fwd.hpp.
+# The tags-* variants define and default-construct types of --tags distinct
+# tags per TU, constrained via std::enable_if<> or via C++20 concepts.
+#
+# Example:
+#   python script/bench-compile-time.py --tus 300 --jobs 1
+#   python script/bench-compile-time.py --phase preprocess --only decl-header --only decl-fwd
+#   python script/bench-compile-time.py --tus 10 --tags 500 --only tags-sfinae --only tags-concepts
+#   python script/bench-compile-time.py --tus 3 --tags 500 --only tags-numeric --only tags-strong
+#
+
+import argparse
+import os
+import shutil
+import subprocess
+import sys
+import tempfile
+import time
+
+# Configuration:
+
+cfg_compiler     = 'g++'
+cfg_std          = 'c++20'
+cfg_tus          = 300
+cfg_tags         = 500
+
+tpl_tu_body = '''
+namespace tu{tu} {{
+
+typedef nonstd::numeric < int   , struct Distance{tu}Tag > Distance;
+typedef nonstd::quantity< double, struct Price{tu}Tag    > Price;
+typedef nonstd::ordered < long  , struct Id{tu}Tag       > Id;
+typedef nonstd::equality< int   , struct Key{tu}Tag      > Key;
+
+Distance total( Distance a, Distance b ) {{ return a + b * Distance( 2 ); }}
+Price    scale( Price p, double f ) {{ return p * f; }}
+bool     less ( Id a, Id b ) {{ return a < b; }}
+bool     same ( Key a, Key b ) {{ return a == b; }}
+
+}} // namespace tu{tu}
+'''
+
+tpl_decl_body = '''
+namespace tu{tu} {{
+
+struct DistanceTag; struct PriceTag; struct IdTag; struct KeyTag;
+
+nonstd::numeric < int   , DistanceTag > total( nonstd::numeric<int, DistanceTag> a, nonstd::numeric<int, DistanceTag> b );
+nonstd::quantity< double, PriceTag    > scale( nonstd::quantity<double, PriceTag> const & p, double f );
+bool less( nonstd::ordered <long, IdTag > const & a, nonstd::ordered <long, IdTag > const & b );
+bool same( nonstd::equality<int , KeyTag> const & a, nonstd::equality<int , KeyTag> const & b );
+
+}} // namespace tu{tu}
+'''
+
+tpl_tag_body = '''
+typedef nonstd::numeric < int   , struct N{tag}Tag > N{tag};
+typedef nonstd::quantity< double, struct Q{tag}Tag > Q{tag};
+typedef nonstd::ordered < long  , struct O{tag}Tag > O{tag};
+
+N{tag} f{tag}( N{tag} n, Q{tag} & q, O{tag} & o ) {{ q = Q{tag}(); o = O{tag}(); return n + N{tag}(); }}
+'''
+
+tpl_arith_body = '''
+typedef {family} A{tag};
+
+A{tag} g{tag}( A{tag} a, A{tag} b ) {{ return a < b || a == b ? a + b * b : a - b / b; }}
+'''
+
+tpl_arith_numeric = 'nonstd::numeric< int, struct A{tag}Tag >'
+tpl_arith_strong  = 'nonstd::strong < int, struct A{tag}Tag, nonstd::skill::equality, nonstd::skill::ordered, ' \
+                    'nonstd::skill::addition, nonstd::skill::subtraction, nonstd::skill::multiplication, nonstd::skill::division >'
+
+tpl_header      = '#include "nonstd/type.hpp"\n' + tpl_tu_body
+tpl_module      = 'import nonstd.type;\n' + tpl_tu_body
+tpl_decl_header = '#include "nonstd/type.hpp"\n' + tpl_decl_body
+tpl_decl_nohash = '#define type_CONFIG_INCLUDE_STD_HASH 0\n#include "nonstd/type.hpp"\n' + tpl_decl_body
+tpl_decl_fwd    = '#include "nonstd/type_fwd.hpp"\n' + tpl_decl_body
+
+def tpl_tags( prefix, tags, body=tpl_tag_body, family='' ):
+    """TU template with tags distinct tags"""
+    body = ''.join( body.format( tag=tag, family=family.format( tag=tag ) ) for tag in range( tags ) )
+    return prefix + '#include "nonstd/type.hpp"\nnamespace tu{tu} {{\n' + body.replace( '{', '{{' ).replace( '}', '}}' ) + '}} // namespace tu{tu}\n'
+
+phases = {
+    'preprocess': lambda src: ['-E', '-o', os.devnull, src],
+    'parse'     : lambda src: ['-fsyntax-only', src],
+    'compile'   : lambda src: ['-c', '-o', src + '.o', src],
+}
+
+# End configuration.
+
+def project_folder():
+    """Project root"""
+    return os.path.normpath( os.path.join( os.path.dirname( os.path.abspath(__file__) ), '..' ) )
+
+def run( cmd, args ):
+    """Run command, raise on failure"""
+    if args.verbose:
+        print( ' '.join( cmd ) )
+    subprocess.check_call( cmd )
+
+def generate( folder, tpl, args ):
+    """Write args.tus translation units from template tpl"""
+    os.makedirs( folder )
+    sources = []
+    for tu in range( args.tus ):
+        path = os.path.join( folder, 'tu{:04}.cpp'.format( tu ) )
+        with open( path, 'w' ) as f:
+            f.write( tpl.format( tu=tu ) )
+        sources.append( path )
+    return sources
+
+def compile_all( sources, flags, args ):
+    """Compile sources, args.jobs at a time; return wall time in seconds"""
+    start = time.time()
+    pending = list( sources )
+    running = []
+    while pending or running:
+        while pending and len( running ) < args.jobs:
+            src = pending.pop( 0 )
+            cmd = [args.compiler] + flags + phases[args.phase]( src )
+            if args.verbose:
+                print( ' '.join( cmd ) )
+            running.append( subprocess.Popen( cmd ) )
+        proc = running.pop( 0 )
+        if proc.wait() != 0:
+            raise RuntimeError( 'compilation failed' )
+    return time.time() - start
+
+def bench_include( name, tpl ):
+    """Time TUs from tpl that include a type-lite header"""
+    def bench( work, args ):
+        sources = generate( os.path.join( work, name ), tpl( args ) if callable( tpl ) else tpl, args )
+        flags = ['-std=' + args.std, '-O0', '-I' + os.path.join( project_folder(), 'include' )]
+        return 0.0, compile_all( sources, flags, args )
+    return bench
+
+def object_size( folder ):
+    """Total size of the object files in folder"""
+    return sum( os.path.getsize( os.path.join( folder, f ) ) for f in os.listdir( folder ) if f.endswith( '.o' ) )
+
+def bench_module( work, args ):
+    """Time building module nonstd.type, and TUs that import it"""
+    folder = os.path.join( work, 'module' )
+    sources = generate( folder, tpl_module, args )
+    mapper = os.path.join( folder, 'module.map' )
+    with open( mapper, 'w' ) as f:
+        f.write( 'nonstd.type {}\n'.format( os.path.join( folder, 'nonstd.type.gcm' ) ) )
+    flags = ['-std=' + args.std, '-O0', '-fmodules-ts', '-fmodule-mapper=' + mapper]
+    start = time.time()
+    run( [args.compiler] + flags + ['-I' + os.path.join( project_folder(), 'include' ),
+        '-xc++', '-c', os.path.join( project_folder(), 'include', 'nonstd', 'type.cppm' ),
+        '-o', os.path.join( folder, 'type.o' )], args )
+    return time.time() - start, compile_all( sources, flags, args )
+
+benches = {
+    'header'     : bench_include( 'header', tpl_header ),
+    'module'     : bench_module,
+    'decl-header': bench_include( 'decl-header', tpl_decl_header ),
+    'decl-nohash': bench_include( 'decl-nohash', tpl_decl_nohash ),
+    'decl-fwd'   : bench_include( 'decl-fwd', tpl_decl_fwd ),
+    'tags-sfinae'  : bench_include( 'tags-sfinae'  , lambda args: tpl_tags( '#define type_CONFIG_CONCEPTS 0\n', args.tags ) ),
+    'tags-concepts': bench_include( 'tags-concepts', lambda args: tpl_tags( '#define type_CONFIG_CONCEPTS 1\n', args.tags ) ),
+    'tags-numeric' : bench_include( 'tags-numeric' , lambda args: tpl_tags( '', args.tags, tpl_arith_body, tpl_arith_numeric ) ),
+    'tags-strong'  : bench_include( 'tags-strong'  , lambda args: tpl_tags( '#include "nonstd/type_strong.hpp"\n', args.tags, tpl_arith_body, tpl_arith_strong ) ),
+}
+
+def main():
+    parser = argparse.ArgumentParser(
+        description='Compile-time benchmark of type-lite as header and as module.',
+        epilog="""""",
+        formatter_class=argparse.RawTextHelpFormatter)
+
+    parser.add_argument(
+        '--compiler',
+        metavar='cxx',
+        default=cfg_compiler,
+        help='compiler to use [{}]'.format( cfg_compiler ))
+
+    parser.add_argument(
+        '--std',
+        metavar='std',
+        default=cfg_std,
+        help='language standard [{}]'.format( cfg_std ))
+
+    parser.add_argument(
+        '--tus',
+        metavar='n',
+        type=int,
+        default=cfg_tus,
+        help='number of translation units [{}]'.format( cfg_tus ))
+
+    parser.add_argument(
+        '--tags',
+        metavar='n',
+        type=int,
+        default=cfg_tags,
+        help='number of distinct tags per TU, tags-* variants [{}]'.format( cfg_tags ))
+
+    parser.add_argument(
+        '--jobs',
+        metavar='n',
+        type=int,
+        default=1,
+        help='number of parallel compilations [1]')
+
+    parser.add_argument(
+        '--phase',
+        metavar='phase',
+        default='compile',
+        choices=sorted( phases.keys() ),
+        help='compile, parse (-fsyntax-only) or preprocess (-E) [compile]')
+
+    parser.add_argument(
+        '--only',
+        metavar='bench',
+        action='append',
+        choices=sorted( benches.keys() ),
+        help='run only this benchmark (repeatable) [all]')
+
+    parser.add_argument(
+        '-v', '--verbose',
+        action='store_true',
+        help='report the commands')
+
+    args = parser.parse_args()
+
+    work = tempfile.mkdtemp( prefix='type-lite-ct-' )
+    try:
+        print( 'Time to {} {} TUs with {} -std={}, {} job(s):\n'.format( args.phase, args.tus, args.compiler, args.std, args.jobs ) )
+        print( '{:<14} {:>10} {:>10} {:>10} {:>12}'.format( 'variant', 'prepare', 'TUs', 'per TU', 'object size' ) )
+        for name in ( args.only or sorted( benches.keys() ) ):
+            prepare, tus = benches[name]( work, args )
+            size = '{}'.format( object_size( os.path.join( work, name ) ) ) if args.phase == 'compile' else '-'
+            print( '{:<14} {:>9.2f}s {:>9.2f}s {:>8.1f}ms {:>12}'.format( name, prepare, tus, 1000.0 * tus / args.tus, size ) )
+    finally:
+        shutil.rmtree( work )
+
+if __name__ == '__main__':
+    main()
+
+# end of file
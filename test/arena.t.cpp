@@ -0,0 +1,141 @@
+// Copyright 2018-2019 by Martin Moene
+//
+// https://github.com/martinmoene/type
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include "type-main.t.hpp"
+#include "nonstd/type_arena.hpp"
+
+#if type_CPP11_OR_GREATER
+
+namespace {
+
+using namespace nonstd;
+
+typedef arena< std::uint32_t, struct GraphTag > Arena;
+typedef Arena::handle_type Handle;
+typedef Arena::offset_type Offset;
+
+struct Edge
+{
+    Handle to;
+    std::uint32_t weight;
+};
+
+// -----------------------------------------------------------------------
+// arena:
+
+CASE( "arena: Hands out 32-bit handles" )
+{
+    EXPECT( sizeof( Handle ) == sizeof( std::uint32_t ) );
+}
+
+CASE( "arena: Allows to allocate an object and resolve its handle" )
+{
+    Arena a( 1024 );
+
+    Handle h = a.allocate<Edge>();
+    Edge * e = a.resolve<Edge>( h );
+
+    e->to     = h;
+    e->weight = 42;
+
+    EXPECT( ( h != Arena::null() ) );
+    EXPECT( a.resolve<Edge>( h )->weight == 42u );
+    EXPECT( ( a.resolve<Edge>( h )->to == h ) );
+    EXPECT( a.owns( h ) );
+}
+
+CASE( "arena: Aligns allocations to the requested alignment" )
+{
+    Arena a( 1024 );
+
+    Handle c = a.allocate<char>();
+    Handle d = a.allocate<double>();
+
+    EXPECT( ( c != Arena::null() ) );
+    EXPECT( to_value( d ) % alignof(double) == 0u );
+}
+
+CASE( "arena: Allows to compute the offset between handles" )
+{
+    Arena a( 1024 );
+
+    Handle h1 = a.allocate<std::uint32_t>();
+    Handle h2 = a.allocate<std::uint32_t>();
+
+    EXPECT( to_value( h2 - h1 ) == sizeof( std::uint32_t ) );
+    EXPECT( ( h1 + Offset( sizeof( std::uint32_t ) ) == h2 ) );
+}
+
+CASE( "arena: Allows to obtain a handle from a pointer into the arena" )
+{
+    Arena a( 1024 );
+
+    Handle h = a.allocate<int>( 4 );
+    int  * p = a.resolve<int>( h );
+
+    EXPECT( ( a.to_handle( p + 2 ) == h + Offset( 2 * sizeof(int) ) ) );
+    EXPECT( ( a.to_handle<int>( nullptr ) == Arena::null() ) );
+}
+
+CASE( "arena: Returns the null handle when exhausted" )
+{
+    Arena a( 64 );
+
+    EXPECT( ( a.allocate<char>( 100 ) == Arena::null() ) );
+    EXPECT( ( a.allocate<char>(  32 ) != Arena::null() ) );
+    EXPECT( ( a.allocate<char>(  32 ) == Arena::null() ) );
+    EXPECT( a.resolve<char>( Arena::null() ) == nullptr );
+}
+
+CASE( "arena: Allows to release all allocations at once" )
+{
+    Arena a( 64 );
+
+    Handle h1 = a.allocate<char>( 32 );
+    EXPECT( a.used() > 0u );
+
+    a.reset();
+
+    Handle h2 = a.allocate<char>( 32 );
+
+    EXPECT( ( h1 == h2 ) );
+    EXPECT( a.used() == 32u );
+    EXPECT( a.available() == a.capacity() - 33u );
+}
+
+CASE( "arena: Leaves a moved-from arena empty, without capacity" )
+{
+    Arena a( 64 );
+    Handle h = a.allocate<char>( 8 );
+
+    Arena b( std::move( a ) );
+
+    EXPECT( a.capacity() == 0u );
+    EXPECT( a.used() == 0u );
+    EXPECT( ( a.allocate<char>() == Arena::null() ) );
+    EXPECT( b.owns( h ) );
+
+    a = std::move( b );
+
+    EXPECT( b.capacity() == 0u );
+    EXPECT( ( b.allocate<char>() == Arena::null() ) );
+    EXPECT( a.owns( h ) );
+    EXPECT( a.capacity() == 64u );
+}
+
+CASE( "arena: Limits the capacity to the range of its handles" )
+{
+    arena< std::uint8_t, struct SmallTag > a( 1000 );
+
+    EXPECT( a.capacity() == 255u );
+    EXPECT( ( a.allocate<char>( 254 ) != a.null() ) );
+    EXPECT( ( a.allocate<char>() == a.null() ) );
+}
+
+} // anonymous namespace
+
+#endif // type_CPP11_OR_GREATER
@@ -0,0 +1,119 @@
+// Copyright 2018-2019 by Martin Moene
+//
+// https://github.com/martinmoene/type
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include "type-main.t.hpp"
+#include "nonstd/type_compact_optional.hpp"
+
+#if type_CPP11_OR_GREATER
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+
+namespace {
+
+using namespace nonstd;
+
+typedef numeric < std::int64_t, struct IdTag , custom_default_t<std::int64_t, -1> > Id;
+typedef quantity< double      , struct TempTag > Temperature;
+
+} // anonymous namespace
+
+// NaN as sentinel for Temperature:
+
+namespace nonstd { namespace types {
+
+template<>
+struct compact_sentinel< Temperature >
+{
+    static Temperature empty() { return Temperature( std::numeric_limits<double>::quiet_NaN() ); }
+
+    static bool is_empty( Temperature const & t ) { return std::isnan( t.get() ); }
+};
+
+}} // namespace nonstd::types
+
+namespace {
+
+// -----------------------------------------------------------------------
+// compact_optional:
+
+CASE( "compact_optional: Has the size of its strong type" )
+{
+    EXPECT( sizeof( compact_optional<Id> ) == sizeof( std::int64_t ) );
+    EXPECT( sizeof( compact_optional<Temperature> ) == sizeof( double ) );
+}
+
+CASE( "compact_optional: Is empty when default-constructed" )
+{
+    compact_optional<Id> o;
+
+    EXPECT( ! o.has_value() );
+    EXPECT( ! o );
+    EXPECT( ( o.value_or( Id( 7 ) ) == Id( 7 ) ) );
+}
+
+CASE( "compact_optional: Allows to construct from a value and to access it" )
+{
+    compact_optional<Id> o = Id( 42 );
+
+    EXPECT( o.has_value() );
+    EXPECT( !!o );
+    EXPECT( ( o.value() == Id( 42 ) ) );
+    EXPECT( ( *o == Id( 42 ) ) );
+    EXPECT( o->get() == 42 );
+    EXPECT( ( o.value_or( Id( 7 ) ) == Id( 42 ) ) );
+}
+
+CASE( "compact_optional: Throws bad_compact_optional_access on value() of an empty optional" )
+{
+    compact_optional<Id>       o;
+    compact_optional<Id> const c;
+
+    EXPECT_THROWS_AS( o.value(), bad_compact_optional_access );
+    EXPECT_THROWS_AS( c.value(), bad_compact_optional_access );
+#if type_CPP17_OR_GREATER
+    EXPECT_THROWS_AS( o.value(), std::bad_optional_access );
+#endif
+}
+
+CASE( "compact_optional: Allows to emplace and to reset a value" )
+{
+    compact_optional<Id> o;
+
+    o.emplace( 3 );
+    EXPECT( ( *o == Id( 3 ) ) );
+
+    o.reset();
+    EXPECT( ! o );
+}
+
+CASE( "compact_optional: Allows to compare for equality" )
+{
+    EXPECT( ( compact_optional<Id>() == compact_optional<Id>() ) );
+    EXPECT( ( compact_optional<Id>( Id( 1 ) ) == compact_optional<Id>( Id( 1 ) ) ) );
+    EXPECT( ( compact_optional<Id>( Id( 1 ) ) != compact_optional<Id>( Id( 2 ) ) ) );
+    EXPECT( ( compact_optional<Id>( Id( 1 ) ) != compact_optional<Id>() ) );
+}
+
+CASE( "compact_optional: Allows a specialized sentinel, such as NaN" )
+{
+    compact_optional<Temperature> o;
+
+    EXPECT( ! o );
+    EXPECT( ( o == compact_optional<Temperature>() ) );
+
+    o = Temperature( 21.5 );
+
+    EXPECT( ( *o == Temperature( 21.5 ) ) );
+}
+
+} // anonymous namespace
+
+#endif // type_CPP11_OR_GREATER
+
+// end of file
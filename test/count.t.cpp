@@ -0,0 +1,123 @@
+// Copyright 2018-2019 by Martin Moene
+//
+// https://github.com/martinmoene/type
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Compiled with type_CONFIG_COUNT_OPERATIONS=1, see test/CMakeLists.txt.
+
+#include "type-main.t.hpp"
+
+#if type_CONFIG_COUNT_OPERATIONS
+
+#include <sstream>
+#include <thread>
+
+namespace {
+
+using namespace nonstd;
+
+typedef quantity< int, struct PriceTag    > Price;
+typedef numeric < int, struct QuantityTag > Quantity;
+typedef numeric < int, struct IdleTag     > Idle;
+
+// -----------------------------------------------------------------------
+// operation counting:
+
+CASE( "count: Allows to count operator calls per strong type and operator" )
+{
+    reset_operation_counts();
+
+    Price    p( 10 );
+    Quantity q( 3 );
+
+    p = p * 2 + p;
+    q = q * q;
+
+    EXPECT( operation_count_of<Price>( types::op_mul ) == 1u );
+    EXPECT( operation_count_of<Price>( types::op_add ) == 1u );
+    EXPECT( operation_count_of<Quantity>( types::op_mul ) == 1u );
+    EXPECT( operation_count_of<Quantity>( types::op_add ) == 0u );
+    EXPECT( operation_count_of<Idle>( types::op_mul ) == 0u );
+}
+
+CASE( "count: Allows to count comparisons" )
+{
+    reset_operation_counts();
+
+    Quantity a( 1 ), b( 2 );
+
+    EXPECT( ( a < b ) );
+    EXPECT( ( a < b ) );
+    EXPECT( ( a == a ) );
+
+    EXPECT( operation_count_of<Quantity>( types::op_lt ) == 2u );
+    EXPECT( operation_count_of<Quantity>( types::op_eq ) == 1u );
+#if type_HAVE_THREE_WAY_COMPARISON
+    EXPECT( ( ( a <=> b ) < 0 ) );
+    EXPECT( operation_count_of<Quantity>( types::op_cmp ) == 1u );
+#endif
+}
+
+CASE( "count: Counts each comparison operator once, also the derived ones" )
+{
+    reset_operation_counts();
+
+    Quantity a( 1 ), b( 2 );
+
+    EXPECT(     ( a != b ) );
+    EXPECT_NOT( ( a >  b ) );
+    EXPECT(     ( a <= b ) );
+    EXPECT_NOT( ( a >= b ) );
+
+    EXPECT( operation_count_of<Quantity>( types::op_ne ) == 1u );
+    EXPECT( operation_count_of<Quantity>( types::op_gt ) == 1u );
+    EXPECT( operation_count_of<Quantity>( types::op_le ) == 1u );
+    EXPECT( operation_count_of<Quantity>( types::op_ge ) == 1u );
+    EXPECT( operation_count_of<Quantity>( types::op_eq ) == 0u );
+    EXPECT( operation_count_of<Quantity>( types::op_lt ) == 0u );
+}
+
+CASE( "count: Leaves operators usable in constant expressions (C++14)" )
+{
+#if type_CPP14_OR_GREATER && type_HAVE_IS_CONSTANT_EVALUATED
+    constexpr Quantity a( 1 ), b( 2 );
+
+    static_assert( ( a + b ).get() == 3, "constant expression" );
+    static_assert( a < b, "constant expression" );
+#endif
+    EXPECT( true );
+}
+
+CASE( "count: Sums counts over threads, also of exited threads" )
+{
+    reset_operation_counts();
+
+    std::thread t( []{ Quantity x( 1 ); for ( int i = 0; i != 100; ++i ) x = x + Quantity( 1 ); } );
+    t.join();
+
+    Quantity y( 1 );
+    y = y + y;
+
+    EXPECT( operation_count_of<Quantity>( types::op_add ) == 101u );
+}
+
+CASE( "count: Allows to dump the counts" )
+{
+    reset_operation_counts();
+
+    Price p( 1 );
+    p = p - p;
+
+    std::ostringstream os;
+    dump_operation_counts( os );
+
+    EXPECT( os.str().find( "PriceTag" ) != std::string::npos );
+    EXPECT( os.str().find( " - 1\n" ) != std::string::npos );
+    EXPECT( os.str().find( "QuantityTag" ) == std::string::npos );
+}
+
+} // anonymous namespace
+
+#endif // type_CONFIG_COUNT_OPERATIONS
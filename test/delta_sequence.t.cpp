@@ -0,0 +1,158 @@
+// Copyright 2018-2019 by Martin Moene
+//
+// https://github.com/martinmoene/type
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include "type-main.t.hpp"
+#include "nonstd/type_delta_sequence.hpp"
+
+#if type_CPP11_OR_GREATER
+
+#include <cstdint>
+#include <iterator>
+#include <random>
+#include <vector>
+
+namespace {
+
+using namespace nonstd;
+
+typedef numeric< std::int64_t , struct TimestampTag > Timestamp;
+typedef ordered< std::uint32_t, struct SeqIdTag     > SeqId;
+typedef numeric< std::int16_t , struct SmallTag     > Small;
+
+template< typename S >
+bool round_trips( std::vector<S> const & v )
+{
+    delta_sequence<S> seq( v.begin(), v.end() );
+
+    if ( seq.size() != v.size() )
+        return false;
+
+    // random access:
+
+    for ( std::size_t i = 0; i != v.size(); ++i )
+        if ( to_value( seq[i] ) != to_value( v[i] ) )
+            return false;
+
+    // sequential:
+
+    std::size_t i = 0;
+    for ( typename delta_sequence<S>::const_iterator pos = seq.begin(); pos != seq.end(); ++pos, ++i )
+        if ( to_value( *pos ) != to_value( v[i] ) )
+            return false;
+
+    return i == v.size();
+}
+
+// -----------------------------------------------------------------------
+// delta_sequence:
+
+CASE( "delta_sequence: Allows to default-construct an empty sequence" )
+{
+    delta_sequence<Timestamp> seq;
+
+    EXPECT( seq.empty() );
+    EXPECT( seq.size() == 0u );
+    EXPECT( ( seq.begin() == seq.end() ) );
+}
+
+CASE( "delta_sequence: Allows to append values and read them back" )
+{
+    delta_sequence<Timestamp> seq;
+
+    for ( std::int64_t t = 1000; t < 1000 + 3 * 300; t += 3 )
+        seq.push_back( Timestamp( t ) );
+
+    EXPECT( seq.size() == 300u );
+    EXPECT( to_value( seq.front() ) == 1000 );
+    EXPECT( to_value( seq[129] ) == 1000 + 3 * 129 );
+    EXPECT( to_value( seq.back() ) == 1000 + 3 * 299 );
+}
+
+CASE( "delta_sequence: Round-trips monotonic sequences" )
+{
+    std::mt19937 gen( 42 );
+    std::vector<Timestamp> v;
+
+    std::int64_t t = 1600000000000000000;
+    for ( int i = 0; i != 10000; ++i )
+        v.push_back( Timestamp( t += static_cast<std::int64_t>( gen() % 1000 ) ) );
+
+    EXPECT( round_trips( v ) );
+}
+
+CASE( "delta_sequence: Round-trips non-monotonic and extreme sequences" )
+{
+    std::mt19937_64 gen( 42 );
+    std::vector<Timestamp> v1;
+    std::vector<SeqId>     v2;
+    std::vector<Small>     v3;
+
+    for ( int i = 0; i != 1000; ++i )
+    {
+        v1.push_back( Timestamp( static_cast<std::int64_t>( gen() ) ) );
+        v2.push_back( SeqId( static_cast<std::uint32_t>( 1000000 - i * 7 ) ) );
+        v3.push_back( Small( static_cast<std::int16_t>( i % 2 ? -32768 : 32767 ) ) );
+    }
+
+    EXPECT( round_trips( v1 ) );
+    EXPECT( round_trips( v2 ) );
+    EXPECT( round_trips( v3 ) );
+}
+
+CASE( "delta_sequence: Allows to copy iterators cheaply, each decoding its own block" )
+{
+    delta_sequence<Timestamp> seq;
+
+    for ( std::int64_t t = 0; t != 1000; ++t )
+        seq.push_back( Timestamp( 10 * t ) );
+
+    typedef delta_sequence<Timestamp>::const_iterator iterator;
+
+    EXPECT( sizeof( iterator ) < 8 * sizeof( void * ) );
+
+    iterator a = seq.begin();
+    EXPECT( to_value( *a ) == 0 );
+
+    iterator b = a;
+    for ( int i = 0; i != 300; ++i )
+        ++b;
+
+    EXPECT( to_value( *b ) == 3000 );
+    EXPECT( to_value( *a ) ==    0 );
+    EXPECT( to_value( *a++ ) == 0 );
+    EXPECT( to_value( *a ) ==   10 );
+    EXPECT( to_value( *b ) == 3000 );
+    EXPECT( std::distance( seq.begin(), seq.end() ) == 1000 );
+}
+
+CASE( "delta_sequence: Stores slowly increasing values compactly" )
+{
+    delta_sequence<Timestamp> seq;
+
+    for ( std::int64_t t = 0; t != 128 * 100; ++t )
+        seq.push_back( Timestamp( 1600000000000000000 + 10 * t + t % 4 ) );
+
+    EXPECT( seq.memory_bytes() * 8 < seq.size() * sizeof( Timestamp ) );
+}
+
+CASE( "delta_sequence: Allows to clear the sequence" )
+{
+    delta_sequence<Timestamp> seq;
+
+    for ( std::int64_t t = 0; t != 200; ++t )
+        seq.push_back( Timestamp( t ) );
+
+    seq.clear();
+
+    EXPECT( seq.empty() );
+    seq.push_back( Timestamp( 7 ) );
+    EXPECT( to_value( seq[0] ) == 7 );
+}
+
+} // anonymous namespace
+
+#endif // type_CPP11_OR_GREATER
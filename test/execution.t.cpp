@@ -0,0 +1,249 @@
+// Copyright 2018-2019 by Martin Moene
+//
+// https://github.com/martinmoene/type
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include "type-main.t.hpp"
+
+#if type_CPP17_OR_GREATER && defined( __has_include )
+# if __has_include( <execution> )
+#  include <execution>
+# endif
+#endif
+
+#if defined( __cpp_lib_execution )
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <numeric>
+#include <type_traits>
+#include <vector>
+
+namespace {
+
+using namespace nonstd;
+
+typedef type    < int              , struct PlainTag    > Plain;
+typedef boolean <                    struct FlagTag     > Flag;
+typedef logical < int              , struct LogicalTag  > Logical;
+typedef equality< int              , struct NameTag     > Name;
+typedef bits    < std::uint32_t    , struct MaskTag     > Mask;
+typedef ordered < int              , struct RankTag     > Rank;
+typedef numeric < std::int64_t     , struct CountTag    > Count;
+typedef quantity< double           , struct EnergyTag   > Energy;
+typedef offset  < std::int64_t     , struct PosTag      > Offset;
+typedef address < std::int64_t, std::int64_t, PosTag    > Address;
+
+// the properties the parallel algorithms rely on to copy, move and swap
+// elements between threads and vector lanes without a scalar fallback:
+
+template< typename S >
+struct parallel_ready : std::integral_constant< bool,
+       std::is_trivially_copyable<S>::value
+    && std::is_trivially_destructible<S>::value
+    && std::is_standard_layout<S>::value
+    && std::is_nothrow_copy_constructible<S>::value
+    && std::is_nothrow_move_constructible<S>::value
+    && std::is_nothrow_move_assignable<S>::value
+    && std::is_nothrow_swappable<S>::value
+    && sizeof( S ) == sizeof( typename S::underlying_type ) >
+{};
+
+static_assert( parallel_ready< Plain   >::value, "type: not ready for parallel algorithms" );
+static_assert( parallel_ready< Flag    >::value, "boolean: not ready for parallel algorithms" );
+static_assert( parallel_ready< Logical >::value, "logical: not ready for parallel algorithms" );
+static_assert( parallel_ready< Name    >::value, "equality: not ready for parallel algorithms" );
+static_assert( parallel_ready< Mask    >::value, "bits: not ready for parallel algorithms" );
+static_assert( parallel_ready< Rank    >::value, "ordered: not ready for parallel algorithms" );
+static_assert( parallel_ready< Count   >::value, "numeric: not ready for parallel algorithms" );
+static_assert( parallel_ready< Energy  >::value, "quantity: not ready for parallel algorithms" );
+static_assert( parallel_ready< Offset  >::value, "offset: not ready for parallel algorithms" );
+static_assert( parallel_ready< Address >::value, "address: not ready for parallel algorithms" );
+
+std::size_t const n = 50000;
+
+std::int64_t scrambled( std::size_t i )
+{
+    return static_cast<std::int64_t>( ( i * 7919 ) % 10007 ) - 5000;
+}
+
+// -----------------------------------------------------------------------
+// parallel algorithms:
+
+CASE( "execution: Allows to swap a type, nothrow" )
+{
+    Plain a( 1 ), b( 2 );
+
+    static_assert( noexcept( swap( a, b ) ), "swap: must be noexcept" );
+
+    swap( a, b );
+
+    EXPECT( a.get() == 2 );
+    EXPECT( b.get() == 1 );
+}
+
+CASE( "execution: Allows std::transform(par_unseq) over numeric values" )
+{
+    std::vector<Count> x, y, z( n ), expected;
+
+    for ( std::size_t i = 0; i != n; ++i )
+    {
+        x.push_back( Count( scrambled( i ) ) );
+        y.push_back( Count( 3 ) );
+        expected.push_back( Count( 3 * scrambled( i ) + 3 ) );
+    }
+
+    std::transform( std::execution::par_unseq, x.begin(), x.end(), y.begin(), z.begin(),
+        []( Count const & a, Count const & b ) { return a * b + b; } );
+
+    EXPECT( std::equal( z.begin(), z.end(), expected.begin() ) );
+}
+
+CASE( "execution: Allows std::transform(par_unseq) over quantity values, scaling and dividing" )
+{
+    std::vector<Energy> x, z( n );
+    std::vector<double> ratio( n );
+
+    for ( std::size_t i = 0; i != n; ++i )
+        x.push_back( Energy( 1.0 + double( i % 10 ) ) );
+
+    std::transform( std::execution::par_unseq, x.begin(), x.end(), z.begin(),
+        []( Energy const & e ) { return 2.0 * e - e / 4.0; } );
+
+    std::transform( std::execution::par_unseq, z.begin(), z.end(), x.begin(), ratio.begin(),
+        []( Energy const & a, Energy const & b ) { return a / b; } );
+
+    EXPECT( std::all_of( ratio.begin(), ratio.end(), []( double r ) { return r == 1.75; } ) );
+}
+
+CASE( "execution: Allows std::transform(par_unseq) over bits and logical values" )
+{
+    std::vector<Mask> m, mz( n );
+    std::vector<Logical> l, lz( n );
+
+    for ( std::size_t i = 0; i != n; ++i )
+    {
+        m.push_back( Mask( static_cast<std::uint32_t>( i ) ) );
+        l.push_back( Logical( static_cast<int>( i % 3 ) ) );
+    }
+
+    std::transform( std::execution::par_unseq, m.begin(), m.end(), mz.begin(),
+        []( Mask const & a ) { return ( ~a & Mask( 0xffu ) ) ^ Mask( 1u ); } );
+
+    std::transform( std::execution::par_unseq, l.begin(), l.end(), lz.begin(),
+        []( Logical const & a ) { return ! a; } );
+
+    for ( std::size_t i = 0; i != n; ++i )
+    {
+        EXPECT( mz[i].get() == ( ( ~static_cast<std::uint32_t>( i ) & 0xffu ) ^ 1u ) );
+        EXPECT( lz[i].get() == int( i % 3 == 0 ) );
+    }
+}
+
+CASE( "execution: Allows std::transform(par_unseq) over address and offset values" )
+{
+    std::vector<Address> a;
+    std::vector<Offset>  d( n );
+
+    for ( std::size_t i = 0; i != n; ++i )
+        a.push_back( Address( 1000 + static_cast<std::int64_t>( 2 * i ) ) );
+
+    std::transform( std::execution::par_unseq, a.begin(), a.end(), d.begin(),
+        []( Address const & x ) { return ( x + Offset( 6 ) ) - Address( 1000 ); } );
+
+    for ( std::size_t i = 0; i != n; ++i )
+        EXPECT( d[i].get() == static_cast<std::int64_t>( 2 * i + 6 ) );
+}
+
+CASE( "execution: Allows std::sort(par) over ordered values" )
+{
+    std::vector<Rank> v;
+    std::vector<int>  expected;
+
+    for ( std::size_t i = 0; i != n; ++i )
+    {
+        v.push_back( Rank( static_cast<int>( scrambled( i ) ) ) );
+        expected.push_back( static_cast<int>( scrambled( i ) ) );
+    }
+
+    std::sort( std::execution::par, v.begin(), v.end() );
+    std::sort( expected.begin(), expected.end() );
+
+    EXPECT( std::is_sorted( v.begin(), v.end() ) );
+    EXPECT( std::equal( v.begin(), v.end(), expected.begin(), []( Rank const & r, int x ) { return r.get() == x; } ) );
+}
+
+CASE( "execution: Allows std::sort(par) with a comparator over offset values" )
+{
+    std::vector<Offset> v;
+
+    for ( std::size_t i = 0; i != n; ++i )
+        v.push_back( Offset( scrambled( i ) ) );
+
+    std::sort( std::execution::par, v.begin(), v.end(), std::greater<Offset>() );
+
+    EXPECT( std::is_sorted( v.begin(), v.end(), std::greater<Offset>() ) );
+}
+
+CASE( "execution: Allows std::reduce(par_unseq) over numeric and quantity values" )
+{
+    std::vector<Count>  c;
+    std::vector<Energy> e;
+
+    std::int64_t expected = 0;
+    for ( std::size_t i = 0; i != n; ++i )
+    {
+        c.push_back( Count( scrambled( i ) ) );
+        e.push_back( Energy( 0.5 ) );
+        expected += scrambled( i );
+    }
+
+    EXPECT( std::reduce( std::execution::par_unseq, c.begin(), c.end(), Count( 0 ) ).get() == expected );
+    EXPECT( std::reduce( std::execution::par_unseq, e.begin(), e.end(), Energy( 0.0 ) ).get() == 0.5 * double( n ) );
+}
+
+CASE( "execution: Allows std::transform_reduce(par_unseq) over quantity values" )
+{
+    std::vector<Energy> e( n, Energy( 2.0 ) );
+    std::vector<double> w( n, 0.25 );
+
+    Energy const total = std::transform_reduce( std::execution::par_unseq, e.begin(), e.end(), w.begin(), Energy( 0.0 ),
+        std::plus<Energy>(), []( Energy const & x, double f ) { return x * f; } );
+
+    EXPECT( total.get() == 0.5 * double( n ) );
+}
+
+CASE( "execution: Allows std::count_if(par_unseq) and std::find(par) over equality and boolean values" )
+{
+    std::vector<Name> v;
+    std::vector<Flag> f;
+
+    for ( std::size_t i = 0; i != n; ++i )
+    {
+        v.push_back( Name( static_cast<int>( i % 10 ) ) );
+        f.push_back( Flag( i == n - 1 ) );
+    }
+
+    EXPECT( std::count_if( std::execution::par_unseq, v.begin(), v.end(), []( Name const & x ) { return x == Name( 7 ); } ) == std::ptrdiff_t( n / 10 ) );
+    EXPECT( std::find( std::execution::par, v.begin(), v.end(), Name( 3 ) ) - v.begin() == 3 );
+    EXPECT( std::find_if( std::execution::par, f.begin(), f.end(), []( Flag const & x ) { return bool( x ); } ) - f.begin() == std::ptrdiff_t( n - 1 ) );
+}
+
+CASE( "execution: Allows std::copy(par_unseq) and std::fill(par_unseq) of plain type values" )
+{
+    std::vector<Plain> v( n ), w( n );
+
+    std::fill( std::execution::par_unseq, v.begin(), v.end(), Plain( 42 ) );
+    std::copy( std::execution::par_unseq, v.begin(), v.end(), w.begin() );
+
+    EXPECT( std::all_of( w.begin(), w.end(), []( Plain const & x ) { return x.get() == 42; } ) );
+}
+
+} // anonymous namespace
+
+#endif // __cpp_lib_execution
+
+// end of file
@@ -0,0 +1,155 @@
+// Copyright 2018-2019 by Martin Moene
+//
+// https://github.com/martinmoene/type
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include "type-main.t.hpp"
+#include "nonstd/type_fixed_point.hpp"
+
+#if type_CPP11_OR_GREATER
+
+#include <cstdint>
+
+namespace {
+
+using namespace nonstd;
+
+typedef fixed_point< std::int64_t , 16, struct PriceTag > Price;
+typedef fixed_point< std::int32_t ,  8, struct RateTag  > Rate;
+typedef fixed_point< std::uint16_t,  4, struct SizeTag  > Size;
+
+template< typename Round >
+struct Third
+{
+    typedef fixed_point< std::int32_t, 8, struct ThirdTag, Round > type;
+};
+
+// -----------------------------------------------------------------------
+// fixed_point:
+
+CASE( "fixed_point: Has the size of its underlying integer type" )
+{
+    EXPECT( sizeof( Price ) == sizeof( std::int64_t ) );
+    EXPECT( sizeof( Size  ) == sizeof( std::uint16_t ) );
+}
+
+CASE( "fixed_point: Allows to construct from floating point, from the raw value and from an integer" )
+{
+    EXPECT( Price().raw() == 0 );
+    EXPECT( Price( 1.5 ).raw() == 3 * 32768 );
+    EXPECT( Price::from_raw( 65536 ).raw() == 65536 );
+    EXPECT( Price::from_integer( -3 ).raw() == -3 * 65536 );
+    EXPECT( Price::one() == 65536 );
+    EXPECT( Price::fraction_bits() == 16 );
+}
+
+CASE( "fixed_point: Allows to convert to floating point" )
+{
+    EXPECT( static_cast<double>( Price( 1.5 ) ) == 1.5 );
+    EXPECT( static_cast<float >( Rate( -0.25 ) ) == -0.25f );
+}
+
+CASE( "fixed_point: Allows to compare" )
+{
+    EXPECT( ( Price( 1.5 ) == Price( 1.5 ) ) );
+    EXPECT( ( Price( 1.5 ) != Price( 2.5 ) ) );
+    EXPECT( ( Price( 1.5 ) <  Price( 2.5 ) ) );
+    EXPECT( ( Price( 1.5 ) <= Price( 1.5 ) ) );
+    EXPECT( ( Price( 2.5 ) >  Price( 1.5 ) ) );
+    EXPECT( ( Price( 2.5 ) >= Price( 2.5 ) ) );
+}
+
+CASE( "fixed_point: Allows to add, subtract, negate, increment and take remainder" )
+{
+    Price p( 1.5 );
+
+    EXPECT( ( p + Price( 0.25 ) == Price( 1.75 ) ) );
+    EXPECT( ( p - Price( 2.0  ) == Price( -0.5 ) ) );
+    EXPECT( ( -p == Price( -1.5 ) ) );
+    EXPECT( ( +p == Price(  1.5 ) ) );
+    EXPECT( ( ++p == Price( 2.5 ) ) );
+    EXPECT( ( p-- == Price( 2.5 ) ) );
+    EXPECT( ( Price( 2.75 ) % Price( 1.0 ) == Price( 0.75 ) ) );
+}
+
+CASE( "fixed_point: Allows to multiply and divide, rescaling the result" )
+{
+    EXPECT( ( Price( 1.5 ) * Price( -2.25 ) == Price( -3.375 ) ) );
+    EXPECT( ( Price( -3.375 ) / Price( 1.5 ) == Price( -2.25 ) ) );
+    EXPECT( ( Size( 2.5 ) * Size( 2.5 ) == Size( 6.25 ) ) );
+    EXPECT( ( Size( 2.5 ) / Size( 0.5 ) == Size( 5.0 ) ) );
+}
+
+CASE( "fixed_point: Allows to multiply and divide with a 128-bit intermediate for a 64-bit underlying type" )
+{
+    Price const big = Price::from_integer( 1000000000 );    // raw value 2^16 * 10^9
+
+    EXPECT( ( big * Price( 4.0 ) / Price( 8.0 ) == Price::from_integer( 500000000 ) ) );
+    EXPECT( ( big / Price( 0.5 ) == Price::from_integer( 2000000000 ) ) );
+}
+
+CASE( "fixed_point: Allows to scale by an integer" )
+{
+    EXPECT( ( Price( 1.25 ) * 4 == Price( 5.0 ) ) );
+    EXPECT( ( 4 * Price( 1.25 ) == Price( 5.0 ) ) );
+    EXPECT( ( Price( 5.0 ) / 4 == Price( 1.25 ) ) );
+}
+
+CASE( "fixed_point: Allows to select rounding of multiplication, division and conversion" )
+{
+    // 1/3 and -1/3 in 1/256 units are 85.33 and -85.33:
+
+    EXPECT( ( Third<round_nearest_t    >::type(  1.0 ) / Third<round_nearest_t    >::type( 3.0 ) ).raw() ==  85 );
+    EXPECT( ( Third<round_nearest_t    >::type( -1.0 ) / Third<round_nearest_t    >::type( 3.0 ) ).raw() == -85 );
+    EXPECT( ( Third<round_toward_zero_t>::type( -1.0 ) / Third<round_toward_zero_t>::type( 3.0 ) ).raw() == -85 );
+    EXPECT( ( Third<round_down_t       >::type( -1.0 ) / Third<round_down_t       >::type( 3.0 ) ).raw() == -86 );
+    EXPECT( ( Third<round_down_t       >::type(  1.0 ) / Third<round_down_t       >::type( 3.0 ) ).raw() ==  85 );
+    EXPECT( ( Third<round_up_t         >::type(  1.0 ) / Third<round_up_t         >::type( 3.0 ) ).raw() ==  86 );
+
+    // 0.5/256 * 1/2 is half a unit:
+
+    EXPECT( ( Third<round_nearest_t    >::type::from_raw(  1 ) * Third<round_nearest_t    >::type( 0.5 ) ).raw() ==  1 );
+    EXPECT( ( Third<round_nearest_t    >::type::from_raw( -1 ) * Third<round_nearest_t    >::type( 0.5 ) ).raw() == -1 );
+    EXPECT( ( Third<round_toward_zero_t>::type::from_raw(  1 ) * Third<round_toward_zero_t>::type( 0.5 ) ).raw() ==  0 );
+
+    EXPECT( Third<round_nearest_t    >::type( -1.0 / 3 ).raw() == -85 );
+    EXPECT( Third<round_down_t       >::type( -1.0 / 3 ).raw() == -86 );
+    EXPECT( Third<round_up_t         >::type(  1.0 / 3 ).raw() ==  86 );
+}
+
+CASE( "fixed_point: Allows to convert from floating point in a constant expression" )
+{
+    constexpr Price p( 2.5 );
+
+    EXPECT( p.raw() == 5 * 32768 );
+}
+
+CASE( "fixed_point: Allows to convert to floating point in a constant expression (C++14)" )
+{
+#if type_CPP14_OR_GREATER
+    constexpr double d = static_cast<double>( Price( 2.5 ) );
+
+    EXPECT( d == 2.5 );
+#else
+    EXPECT( !!"type: constexpr conversion to floating point is not available (no C++14)" );
+#endif
+}
+
+CASE( "fixed_point: Allows to multiply and divide in a constant expression (C++14)" )
+{
+#if type_CPP14_OR_GREATER && ! type_CONFIG_COUNT_OPERATIONS
+    constexpr Price p = Price( 0.5 ) * Price( 0.25 ) / Price( 2.0 );
+
+    EXPECT( ( p == Price( 0.0625 ) ) );
+#else
+    EXPECT( !!"type: constexpr multiplication is not available (no C++14, or operations counted)" );
+#endif
+}
+
+} // anonymous namespace
+
+#endif // type_CPP11_OR_GREATER
+
+// end of file
@@ -0,0 +1,109 @@
+// Copyright 2018-2019 by Martin Moene
+//
+// https://github.com/martinmoene/type
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Declarations that only need type_fwd.hpp, and std::hash<> support via
+// type_hash.hpp rather than via type.hpp:
+
+#include "nonstd/type_fwd.hpp"
+
+namespace {
+
+struct MeterTag;
+
+nonstd::numeric<int, MeterTag> twice( nonstd::numeric<int, MeterTag> x );
+nonstd::ordered<int, struct RankTag, nonstd::custom_default_t<int, 7> > rank();
+nonstd::equality<int, struct KeyTag, nonstd::no_default_t> key( int k );
+
+} // anonymous namespace
+
+#define type_CONFIG_INCLUDE_STD_HASH  0
+
+#include "type-main.t.hpp"
+#include "nonstd/type_stream.hpp"
+
+#include <sstream>
+
+namespace {
+
+using namespace nonstd;
+
+typedef numeric <int, MeterTag       > Meter;
+typedef quantity<double, struct MassTag> Mass;
+
+Meter twice( Meter x )
+{
+    return x + x;
+}
+
+ordered<int, RankTag, custom_default_t<int, 7> > rank()
+{
+    return ordered<int, RankTag, custom_default_t<int, 7> >();
+}
+
+equality<int, KeyTag, no_default_t> key( int k )
+{
+    return equality<int, KeyTag, no_default_t>( k );
+}
+
+// -----------------------------------------------------------------------
+// type_fwd.hpp:
+
+CASE( "fwd: Allows to declare functions with strong types using only type_fwd.hpp" )
+{
+    EXPECT( to_value( twice( Meter( 21 ) ) ) == 42 );
+    EXPECT( to_value( rank() ) == 7 );
+    EXPECT( ( key( 3 ) == key( 3 ) ) );
+}
+
+// -----------------------------------------------------------------------
+// type_stream.hpp:
+
+CASE( "stream: Allows to write a strong type as its underlying value" )
+{
+    std::ostringstream os;
+
+    os << Meter( 42 ) << ' ' << Mass( 1.5 );
+
+    EXPECT( os.str() == "42 1.5" );
+}
+
+CASE( "stream: Allows to read a strong type as its underlying value" )
+{
+    std::istringstream is( "42 1.5" );
+    Meter m;
+    Mass  w;
+
+    is >> m >> w;
+
+    EXPECT( to_value( m ) == 42 );
+    EXPECT( to_value( w ) == 1.5 );
+}
+
+// -----------------------------------------------------------------------
+// type_hash.hpp:
+
+} // anonymous namespace
+
+#include "nonstd/type_hash.hpp"
+
+namespace {
+
+using namespace nonstd;
+
+CASE( "hash: Allows to obtain hash via type_hash.hpp, with type_CONFIG_INCLUDE_STD_HASH 0 (C++11)" )
+{
+#if type_HAVE_STD_HASH
+    EXPECT( make_hash( Meter( 7 ) ) == std::hash<int>()( 7 ) );
+    EXPECT( make_hash( Meter( 7 ) ) != make_hash( Meter( 9 ) ) );
+#else
+    EXPECT( !!"type: std::hash is not available (no C++11)" );
+#endif
+}
+
+} // anonymous namespace
+
+// end of file
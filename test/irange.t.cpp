@@ -0,0 +1,115 @@
+// Copyright 2018-2019 by Martin Moene
+//
+// https://github.com/martinmoene/type
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include "type-main.t.hpp"
+#include "nonstd/type_irange.hpp"
+
+#include <algorithm>
+#include <vector>
+
+namespace {
+
+using namespace nonstd;
+
+typedef numeric< int, struct RowTag > RowIdx;
+typedef numeric< int, struct RowTag, no_default_t > RowIdxND;
+
+struct is_less_than
+{
+    RowIdx limit;
+    explicit is_less_than( RowIdx limit_ ) : limit( limit_ ) {}
+    bool operator()( RowIdx const & x ) const { return x < limit; }
+};
+
+// -----------------------------------------------------------------------
+// irange:
+
+CASE( "irange: Allows to iterate over [first..last) of strong indices" )
+{
+    std::vector<int> v;
+
+    irange<RowIdx> r( RowIdx(3), RowIdx(7) );
+
+    for ( irange<RowIdx>::iterator pos = r.begin(); pos != r.end(); ++pos )
+    {
+        v.push_back( to_value( *pos ) );
+    }
+
+    EXPECT( v.size() == 4u );
+    EXPECT( v.front() == 3 );
+    EXPECT( v.back()  == 6 );
+}
+
+CASE( "irange: Allows to iterate over [0..last) of strong indices" )
+{
+    irange<RowIdx> r( RowIdx(5) );
+
+    EXPECT( r.size() == 5u );
+    EXPECT( to_value( r.front() ) == 0 );
+    EXPECT( to_value( r.back()  ) == 4 );
+}
+
+CASE( "irange: Allows to use a non-default-constructible index" )
+{
+    irange<RowIdxND> r( RowIdxND(1), RowIdxND(3) );
+
+    EXPECT( r.size() == 2u );
+    EXPECT( to_value( r[1] ) == 2 );
+}
+
+CASE( "irange: Yields an empty range if last precedes first" )
+{
+    irange<RowIdx> r( RowIdx(7), RowIdx(3) );
+
+    EXPECT( r.empty() );
+    EXPECT( r.size() == 0u );
+    EXPECT( ( r.begin() == r.end() ) );
+}
+
+CASE( "irange: Allows random access via the index and iterator" )
+{
+    irange<RowIdx> r( RowIdx(10), RowIdx(20) );
+
+    EXPECT( to_value( r[3] ) == 13 );
+    EXPECT( to_value( r.begin()[4] ) == 14 );
+    EXPECT( to_value( *( r.begin() + 5 ) ) == 15 );
+    EXPECT( to_value( *( r.end() - 1 ) ) == 19 );
+    EXPECT( ( r.end() - r.begin() ) == 10 );
+    EXPECT( ( r.begin() < r.end() ) );
+}
+
+CASE( "irange: Allows to use standard algorithms" )
+{
+    irange<RowIdx> r( RowIdx(0), RowIdx(10) );
+
+    EXPECT( std::count_if( r.begin(), r.end(), is_less_than( RowIdx(4) ) ) == 4 );
+    EXPECT( std::distance( r.begin(), r.end() ) == 10 );
+}
+
+CASE( "irange: Allows to create an irange via make_irange()" )
+{
+    EXPECT( make_irange( RowIdx(4) ).size() == 4u );
+    EXPECT( make_irange( RowIdx(2), RowIdx(4) ).size() == 2u );
+}
+
+CASE( "irange: Allows to use range-for (C++11)" )
+{
+#if type_CPP11_OR_GREATER
+    int sum = 0;
+
+    for ( RowIdx i : irange<RowIdx>( RowIdx(1), RowIdx(5) ) )
+    {
+        sum += to_value( i );
+    }
+
+    EXPECT( sum == 10 );
+#else
+    EXPECT( !!"irange: range-for is not available (no C++11)" );
+#endif
+}
+
+} // anonymous namespace
@@ -0,0 +1,166 @@
+// Copyright 2018-2019 by Martin Moene
+//
+// https://github.com/martinmoene/type
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include "type-main.t.hpp"
+#include "nonstd/type_mixed.hpp"
+
+#if type_CPP11_OR_GREATER
+
+#include <cstdint>
+
+struct CountTag;
+struct MassTag;
+
+namespace nonstd { namespace types {
+
+// opt in for tags CountTag and MassTag:
+
+template<> struct mixed_arithmetic< CountTag > : std::true_type {};
+template<> struct mixed_arithmetic< MassTag  > : std::true_type {};
+
+// no signed type holds int32_t and uint64_t; combine them to int64_t:
+
+template<>
+struct mixed_result< numeric<std::int32_t, CountTag>, numeric<std::uint64_t, CountTag> >
+{
+    typedef numeric<std::int64_t, CountTag> type;
+};
+
+}} // namespace nonstd::types
+
+namespace {
+
+using namespace nonstd;
+
+typedef numeric < std::int32_t , CountTag > Count32;
+typedef numeric < std::int64_t , CountTag > Count64;
+typedef numeric < std::uint32_t, CountTag > CountU32;
+typedef numeric < std::uint64_t, CountTag > CountU64;
+typedef numeric < std::uint8_t , CountTag > CountU8;
+typedef quantity< float        , MassTag  > MassF;
+typedef quantity< double       , MassTag  > MassD;
+
+typedef numeric < std::int32_t , struct LengthTag > Length32;
+typedef numeric < std::int64_t , LengthTag        > Length64;
+
+template< typename X, typename Y, typename = void >
+struct can_add : std::false_type {};
+
+template< typename X, typename Y >
+struct can_add< X, Y, decltype( void( std::declval<X>() + std::declval<Y>() ) ) > : std::true_type {};
+
+template< typename X, typename Y, typename = void >
+struct can_multiply : std::false_type {};
+
+template< typename X, typename Y >
+struct can_multiply< X, Y, decltype( void( std::declval<X>() * std::declval<Y>() ) ) > : std::true_type {};
+
+template< typename X, typename Y, typename = void >
+struct can_add_assign : std::false_type {};
+
+template< typename X, typename Y >
+struct can_add_assign< X, Y, decltype( void( std::declval<X&>() += std::declval<Y>() ) ) > : std::true_type {};
+
+// -----------------------------------------------------------------------
+// mixed arithmetic:
+
+CASE( "mixed: Allows arithmetic of numeric types of the same tag with different underlying types" )
+{
+    Count32 a( 7 );
+    Count64 b( 3 );
+
+    EXPECT( to_value( a + b ) == 10 );
+    EXPECT( to_value( a - b ) ==  4 );
+    EXPECT( to_value( b - a ) == -4 );
+    EXPECT( to_value( a * b ) == 21 );
+    EXPECT( to_value( a / b ) ==  2 );
+    EXPECT( to_value( a % b ) ==  1 );
+}
+
+CASE( "mixed: Allows arithmetic of quantity types of the same tag with different underlying types" )
+{
+    MassF a( 1.5f );
+    MassD b( 0.25 );
+
+    EXPECT( to_value( a + b ) == 1.75 );
+    EXPECT( to_value( a - b ) == 1.25 );
+    EXPECT( ( can_multiply< MassF, MassD >::value == false ) );
+}
+
+CASE( "mixed: Yields the common type of the underlying types by default" )
+{
+    EXPECT( ( std::is_same< decltype( Count32() + Count64() ), Count64 >::value ) );
+    EXPECT( ( std::is_same< decltype( Count64() * Count32() ), Count64 >::value ) );
+    EXPECT( ( std::is_same< decltype( MassF()   + MassD()   ), MassD   >::value ) );
+}
+
+CASE( "mixed: Yields a signed type that holds both ranges for integers of different signedness" )
+{
+    EXPECT( ( std::is_same< decltype( Count32() + CountU32() ), Count64 >::value ) );
+    EXPECT( ( std::is_same< decltype( Count32() + CountU8()  ), Count32 >::value ) );
+    EXPECT( ( std::is_same< decltype( CountU8() + Count64()  ), Count64 >::value ) );
+
+    EXPECT( to_value( Count32( -1 ) + CountU32( 1 ) ) == 0 );
+    EXPECT( to_value( Count32( -1 ) - CountU32( 4000000000u ) ) == -4000000001LL );
+    EXPECT(   ( Count32( -1 ) <  CountU32( 1 ) ) );
+    EXPECT( ! ( Count32( -1 ) == CountU32( 0xFFFFFFFFu ) ) );
+}
+
+CASE( "mixed: Allows to specify the result type via mixed_result<>" )
+{
+    EXPECT( ( std::is_same< decltype( Count32() + CountU64() ), Count64 >::value ) );
+    EXPECT( to_value( Count32( -1 ) + CountU64( 1 ) ) == 0 );
+}
+
+CASE( "mixed: Allows to add-assign, subtract-assign without narrowing only" )
+{
+    Count64 x( 5 );
+
+    x += Count32( 2 );
+    EXPECT( to_value( x ) == 7 );
+
+    x -= Count32( 3 );
+    EXPECT( to_value( x ) == 4 );
+
+    EXPECT( ( can_add_assign< Count64, Count32 >::value == true  ) );
+    EXPECT( ( can_add_assign< Count32, Count64 >::value == false ) );
+}
+
+CASE( "mixed: Allows to compare types of the same tag with different underlying types" )
+{
+    EXPECT(   ( Count32( 7 ) == Count64( 7 ) ) );
+    EXPECT(   ( Count32( 7 ) != Count64( 8 ) ) );
+    EXPECT(   ( Count32( 7 ) <  Count64( 8 ) ) );
+    EXPECT(   ( Count32( 7 ) <= Count64( 7 ) ) );
+    EXPECT(   ( Count64( 8 ) >  Count32( 7 ) ) );
+    EXPECT(   ( Count64( 8 ) >= Count32( 8 ) ) );
+    EXPECT(   ( Count32( -1 ) < CountU32( 0 ) ) );
+}
+
+CASE( "mixed: Disallows mixed arithmetic without opt-in, and between different tags" )
+{
+    EXPECT( ( can_add< Length32, Length64 >::value == false ) );
+    EXPECT( ( can_add< Count32 , Length64 >::value == false ) );
+    EXPECT( ( can_add< Count32 , Count32  >::value == true  ) );
+}
+
+CASE( "mixed: Allows mixed arithmetic in a constant expression (C++14)" )
+{
+#if type_CPP14_OR_GREATER && ! type_CONFIG_COUNT_OPERATIONS
+    constexpr Count64 x = Count32( 2 ) + Count64( 3 );
+
+    EXPECT( to_value( x ) == 5 );
+#else
+    EXPECT( !!"type: constexpr mixed arithmetic is not available (no C++14, or operations counted)" );
+#endif
+}
+
+} // anonymous namespace
+
+#endif // type_CPP11_OR_GREATER
+
+// end of file
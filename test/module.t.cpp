@@ -0,0 +1,55 @@
+// Copyright 2018-2019 by Martin Moene
+//
+// https://github.com/martinmoene/type
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Compiled as C++20 and linked with module nonstd.type, see test/CMakeLists.txt.
+// Does not use lest: GCC 12 may fail on standard library templates that are
+// instantiated before the import declaration.
+
+#include <cstdio>
+#include <functional>
+
+import nonstd.type;
+
+namespace {
+
+using namespace nonstd;
+
+typedef numeric < int, struct DistanceTag > Distance;
+typedef quantity< int, struct PriceTag    > Price;
+typedef ordered < int, struct IdTag       > Id;
+
+int failures = 0;
+
+void expect( bool ok, char const * what )
+{
+    if ( !ok )
+    {
+        std::printf( "module.t.cpp: failed: %s\n", what );
+        ++failures;
+    }
+}
+
+} // anonymous namespace
+
+int main()
+{
+    // module: Allows to use the strong type families via import nonstd.type
+
+    Distance d( 3 );
+
+    expect( to_value( d + Distance( 4 ) ) == 7, "numeric: +" );
+    expect( to_value( d * Distance( 2 ) ) == 6, "numeric: *" );
+    expect( to_value( Price( 6 ) / 3 ) == 2   , "quantity: / T" );
+    expect( Id( 1 ) < Id( 2 )                 , "ordered: <" );
+    expect( Id( 2 ) != Id( 1 )                , "ordered: !=" );
+
+    // module: Allows to hash a strong type via import nonstd.type
+
+    expect( make_hash( Id( 42 ) ) == std::hash<int>()( 42 ), "make_hash()" );
+
+    return failures;
+}
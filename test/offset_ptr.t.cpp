@@ -0,0 +1,147 @@
+// Copyright 2018-2019 by Martin Moene
+//
+// https://github.com/martinmoene/type
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include "type-main.t.hpp"
+#include "nonstd/type_offset_ptr.hpp"
+
+#include <cstring>
+
+namespace {
+
+using namespace nonstd;
+
+struct Node
+{
+    int value;
+    offset_ptr< Node, struct NodeTag > next;
+};
+
+typedef offset_ptr< Node, struct NodeTag > NodePtr;
+typedef offset_ptr< int , struct IntTag  > IntPtr;
+typedef offset_ptr< int , struct NearTag, short > NearPtr;
+
+// a region of nodes, to be copied as a whole:
+
+struct Region
+{
+    Node nodes[3];
+    NodePtr head;
+};
+
+void make_list( Region & r )
+{
+    r.nodes[0].value = 1; r.nodes[0].next = &r.nodes[2];
+    r.nodes[2].value = 3; r.nodes[2].next = &r.nodes[1];
+    r.nodes[1].value = 2; r.nodes[1].next = 0;
+    r.head = &r.nodes[0];
+}
+
+int sum_list( Region const & r )
+{
+    int sum = 0;
+    for ( Node * p = r.head.get(); p; p = p->next.get() )
+    {
+        sum = 10 * sum + p->value;
+    }
+    return sum;
+}
+
+// -----------------------------------------------------------------------
+// offset_ptr:
+
+CASE( "offset_ptr: Allows to default-construct a null offset_ptr" )
+{
+    IntPtr p;
+
+    EXPECT( !p );
+    EXPECT( p.get() == static_cast<int *>( 0 ) );
+}
+
+CASE( "offset_ptr: Allows to construct an offset_ptr from a pointer" )
+{
+    int x = 42;
+    IntPtr p( &x );
+
+    EXPECT( !!p );
+    EXPECT( p.get() == &x );
+    EXPECT( *p == 42 );
+}
+
+CASE( "offset_ptr: Allows to copy-construct and copy-assign an offset_ptr" )
+{
+    int x = 42;
+    IntPtr p( &x );
+    IntPtr q( p );
+    IntPtr r;
+
+    r = p;
+
+    EXPECT( q.get() == &x );
+    EXPECT( r.get() == &x );
+    EXPECT( ( p == q ) );
+    EXPECT( ( q.to_offset() != p.to_offset() ) );
+}
+
+CASE( "offset_ptr: Allows to access members and elements" )
+{
+    int a[] = { 1, 2, 3, };
+    Node n;
+    n.value = 7;
+
+    NodePtr np( &n );
+    IntPtr  ip( a );
+
+    EXPECT( np->value == 7 );
+    EXPECT( ip[2] == 3 );
+}
+
+CASE( "offset_ptr: Allows pointer arithmetic and comparison" )
+{
+    int a[] = { 1, 2, 3, };
+    IntPtr p( a );
+    IntPtr q( p + 2 );
+
+    EXPECT( *q == 3 );
+    EXPECT( ( q - p ) == 2 );
+    EXPECT( ( p < q ) );
+    EXPECT( *++p == 2 );
+    EXPECT( *--q == 2 );
+    EXPECT( ( p == q ) );
+}
+
+CASE( "offset_ptr: Allows a narrow offset type for pointees within its reach" )
+{
+    struct Near
+    {
+        int values[4];
+        NearPtr p;
+    } n = { { 1, 2, 3, 4, }, 0 };
+
+    n.p = &n.values[1];
+    n.p += 2;
+
+    EXPECT( *n.p == 4 );
+    EXPECT( *--n.p == 3 );
+    EXPECT( n.p.to_offset().get() == -2 * int( sizeof(int) ) );
+}
+
+CASE( "offset_ptr: Keeps a linked structure valid after relocating its region" )
+{
+    Region * r1 = new Region();
+    make_list( *r1 );
+
+    Region * r2 = new Region();
+    std::memcpy( static_cast<void *>( r2 ), static_cast<void const *>( r1 ), sizeof( Region ) );
+    delete r1;
+
+    EXPECT( sum_list( *r2 ) == 132 );
+    EXPECT( r2->head.get() == &r2->nodes[0] );
+
+    delete r2;
+}
+
+} // anonymous namespace
@@ -0,0 +1,142 @@
+// Copyright 2018-2019 by Martin Moene
+//
+// https://github.com/martinmoene/type
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include "type-main.t.hpp"
+#include "nonstd/type_packed_array.hpp"
+#include "nonstd/type_ranged.hpp"
+
+#if type_CPP11_OR_GREATER
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+namespace {
+
+using namespace nonstd;
+
+typedef ordered< std::uint8_t , struct PriorityTag > Priority;
+typedef numeric< std::uint16_t, struct PortSlotTag > PortSlot;
+typedef numeric< std::int16_t , struct OffsetTag   > Offset;
+typedef ranged < 0, 7         , struct LevelTag    > Level;
+
+typedef packed_array< Priority, 3  > Priorities;
+typedef packed_array< PortSlot, 12 > PortSlots;
+typedef packed_array< Offset  , 5  > Offsets;
+
+// -----------------------------------------------------------------------
+// packed_array:
+
+CASE( "packed_array: Allows to store and retrieve strong values of N bits" )
+{
+    PortSlots a( 100 );
+
+    for ( std::size_t i = 0; i != a.size(); ++i )
+        a[i] = PortSlot( static_cast<std::uint16_t>( i * 41 % 4096 ) );
+
+    bool same = true;
+    for ( std::size_t i = 0; i != a.size(); ++i )
+        same = same && to_value( PortSlot( a[i] ) ) == i * 41 % 4096;
+
+    EXPECT( same );
+    EXPECT( a.size_bytes() <= ( 100 * 12 / 64 + 2 ) * 8u );
+}
+
+CASE( "packed_array: Leaves neighbouring values intact on assignment" )
+{
+    Priorities a( 30, Priority( 7 ) );
+
+    a[10] = Priority( 0 );
+    a[21] = Priority( 2 );        // straddles a word boundary
+
+    EXPECT( ( a[ 9] == Priority( 7 ) ) );
+    EXPECT( ( a[10] == Priority( 0 ) ) );
+    EXPECT( ( a[11] == Priority( 7 ) ) );
+    EXPECT( ( a[20] == Priority( 7 ) ) );
+    EXPECT( ( a[21] == Priority( 2 ) ) );
+    EXPECT( ( a[22] == Priority( 7 ) ) );
+}
+
+CASE( "packed_array: Allows to store signed values" )
+{
+    Offsets a;
+
+    a.push_back( Offset( -16 ) );
+    a.push_back( Offset(  15 ) );
+    a.push_back( Offset(  -1 ) );
+
+    EXPECT( to_value( a.front() ) == -16 );
+    EXPECT( to_value( Offset( a[1] ) ) == 15 );
+    EXPECT( to_value( a.back() ) == -1 );
+}
+
+CASE( "packed_array: Preserves the operators of the element type" )
+{
+    PortSlots a( 2 );
+
+    a[0] = PortSlot( 100 );
+    a[1] = PortSlot( a[0] ) + PortSlot( 5 );
+
+    EXPECT( ( PortSlot( a[1] ) == PortSlot( 105 ) ) );
+    EXPECT( ( PortSlot( a[0] ) <  PortSlot( a[1] ) ) );
+}
+
+CASE( "packed_array: Allows to store ranged values" )
+{
+    packed_array< Level, 3 > a( 4 );
+
+    a[3] = Level( 7 );
+
+    EXPECT( Level( a[3] ).value() == 7 );
+    EXPECT( Level( a[0] ).value() == 0 );
+}
+
+CASE( "packed_array: Allows to iterate over the values" )
+{
+    std::vector<Priority> v;
+    for ( int i = 0; i != 50; ++i )
+        v.push_back( Priority( static_cast<std::uint8_t>( i % 8 ) ) );
+
+    Priorities a( v.begin(), v.end() );
+
+    EXPECT( a.end() - a.begin() == 50 );
+    EXPECT( std::equal( a.begin(), a.end(), v.begin() ) );
+    EXPECT( std::count( a.begin(), a.end(), Priority( 3 ) ) == 6 );
+}
+
+CASE( "packed_array: Allows to bulk-unpack and -pack values at any position" )
+{
+    std::vector<PortSlot> in;
+    for ( int i = 0; i != 200; ++i )
+        in.push_back( PortSlot( static_cast<std::uint16_t>( i * 17 % 4096 ) ) );
+
+    PortSlots a( 300, PortSlot( 4095 ) );
+    a.pack( in.data(), in.size(), 37 );
+
+    std::vector<PortSlot> out( in.size() );
+    a.unpack( 37, out.size(), out.data() );
+
+    EXPECT( std::equal( in.begin(), in.end(), out.begin() ) );
+    EXPECT( ( a[ 36] == PortSlot( 4095 ) ) );
+    EXPECT( ( a[237] == PortSlot( 4095 ) ) );
+}
+
+CASE( "packed_array: Yields zeroes after shrinking and growing" )
+{
+    Priorities a( 40, Priority( 5 ) );
+
+    a.resize( 10 );
+    a.resize( 40 );
+
+    EXPECT( ( a[ 9] == Priority( 5 ) ) );
+    EXPECT( ( a[10] == Priority( 0 ) ) );
+    EXPECT( ( a[39] == Priority( 0 ) ) );
+}
+
+} // anonymous namespace
+
+#endif // type_CPP11_OR_GREATER
@@ -0,0 +1,133 @@
+// Copyright 2018-2019 by Martin Moene
+//
+// https://github.com/martinmoene/type
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include "type-main.t.hpp"
+#include "nonstd/type_radix_sort.hpp"
+
+#if type_CPP11_OR_GREATER
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace {
+
+using namespace nonstd;
+
+typedef ordered < std::uint64_t, struct TimestampTag > Timestamp;
+typedef numeric < std::int32_t , struct DeltaTag     > Delta;
+typedef quantity< double       , struct EnergyTag    > Energy;
+typedef ordered < std::int16_t , struct ShortTag, no_default_t > Short;
+
+template< typename S, typename Gen >
+std::vector<S> make_values( std::size_t n, Gen gen )
+{
+    std::vector<S> v;
+    v.reserve( n );
+
+    for ( std::size_t i = 0; i != n; ++i )
+        v.push_back( S( gen() ) );
+
+    return v;
+}
+
+template< typename S >
+bool is_sorted_as_std_sort( std::vector<S> v, unsigned threads )
+{
+    std::vector<S> expected( v );
+    std::stable_sort( expected.begin(), expected.end() );
+
+    radix_sort( v.begin(), v.end(), threads );
+
+    return std::equal( v.begin(), v.end(), expected.begin(), []( S const & a, S const & b ) { return to_value( a ) == to_value( b ); } );
+}
+
+// -----------------------------------------------------------------------
+// radix_sort:
+
+CASE( "radix_sort: Allows to sort unsigned integer-based strong types" )
+{
+    std::mt19937_64 gen( 42 );
+
+    EXPECT( is_sorted_as_std_sort( make_values<Timestamp>( 10000, [&]{ return gen(); } ), 1 ) );
+    EXPECT( is_sorted_as_std_sort( make_values<Timestamp>( 10000, [&]{ return gen() & 0xFFFF; } ), 1 ) );
+}
+
+CASE( "radix_sort: Allows to sort signed integer-based strong types" )
+{
+    std::mt19937 gen( 42 );
+
+    EXPECT( is_sorted_as_std_sort( make_values<Delta>( 10000, [&]{ return static_cast<std::int32_t>( gen() ); } ), 1 ) );
+    EXPECT( is_sorted_as_std_sort( make_values<Short>( 10000, [&]{ return static_cast<std::int16_t>( gen() ); } ), 1 ) );
+}
+
+CASE( "radix_sort: Allows to sort floating point-based strong types" )
+{
+    std::mt19937 gen( 42 );
+    std::uniform_real_distribution<double> dist( -1e6, 1e6 );
+
+    std::vector<Energy> v = make_values<Energy>( 10000, [&]{ return dist( gen ); } );
+    v.push_back( Energy( 0.0 ) );
+    v.push_back( Energy( -1e300 ) );
+    v.push_back( Energy( std::numeric_limits<double>::infinity() ) );
+    v.push_back( Energy( -std::numeric_limits<double>::infinity() ) );
+
+    EXPECT( is_sorted_as_std_sort( v, 1 ) );
+}
+
+CASE( "radix_sort: Sorts stable" )
+{
+    std::vector<Delta> v;
+    v.push_back( Delta( 3 ) );
+    v.push_back( Delta(-1 ) );
+    v.push_back( Delta( 3 ) );
+    v.push_back( Delta( 0 ) );
+
+    radix_sort( v.begin(), v.end() );
+
+    EXPECT( to_value( v[0] ) == -1 );
+    EXPECT( to_value( v[1] ) ==  0 );
+    EXPECT( to_value( v[2] ) ==  3 );
+    EXPECT( to_value( v[3] ) ==  3 );
+}
+
+CASE( "radix_sort: Allows to sort in parallel with the same result" )
+{
+    std::mt19937_64 gen( 7 );
+
+    std::vector<Timestamp> v = make_values<Timestamp>( 1 << 18, [&]{ return gen(); } );
+
+    EXPECT( is_sorted_as_std_sort( v, 4 ) );
+    EXPECT( is_sorted_as_std_sort( v, 0 ) );
+}
+
+CASE( "radix_sort: Allows to sort an empty or single-element range" )
+{
+    std::vector<Delta> v;
+
+    radix_sort( v.begin(), v.end() );
+    EXPECT( v.empty() );
+
+    v.push_back( Delta( 7 ) );
+    radix_sort( v.begin(), v.end() );
+    EXPECT( to_value( v[0] ) == 7 );
+}
+
+CASE( "radix_sort: Disallows floating point types other than 32-bit and 64-bit IEEE (define type_CONFIG_CONFIRMS_COMPILATION_ERRORS)" )
+{
+#if type_CONFIG_CONFIRMS_COMPILATION_ERRORS
+    typedef ordered< long double, struct LongTag > Long;
+    std::vector<Long> v;
+    radix_sort( v.begin(), v.end() );
+#endif
+    EXPECT( true );
+}
+
+} // anonymous namespace
+
+#endif // type_CPP11_OR_GREATER
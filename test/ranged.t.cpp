@@ -0,0 +1,139 @@
+// Copyright 2018-2019 by Martin Moene
+//
+// https://github.com/martinmoene/type
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include "type-main.t.hpp"
+#include "nonstd/type_ranged.hpp"
+
+#if type_CPP11_OR_GREATER
+
+#include <cstdint>
+
+namespace {
+
+using namespace nonstd;
+
+typedef ranged<    0,   200, struct PercentTag > Percent;
+typedef ranged< -100,   100, struct DeltaTag   > Delta;
+typedef ranged<   10,    20, struct LevelTag   > Level;
+typedef ranged<    0, 70000, struct PortTag    > Port;
+
+// -----------------------------------------------------------------------
+// ranged:
+
+CASE( "ranged: Selects the smallest storage type that holds the range" )
+{
+    EXPECT( sizeof( Percent ) == 1u );
+    EXPECT( sizeof( Delta   ) == 1u );
+    EXPECT( sizeof( Port    ) == 4u );
+
+    EXPECT( ( std::is_same< Percent::storage_type, std::uint8_t  >::value ) );
+    EXPECT( ( std::is_same< Delta  ::storage_type, std::int8_t   >::value ) );
+    EXPECT( ( std::is_same< Port   ::storage_type, std::uint32_t >::value ) );
+    EXPECT( ( std::is_same< ranged< -1, 200, struct T >::storage_type, std::int16_t >::value ) );
+}
+
+CASE( "ranged: Allows to default-construct, to zero or to the bound nearest zero" )
+{
+    EXPECT( Percent().value() ==  0 );
+    EXPECT( Level  ().value() == 10 );
+}
+
+CASE( "ranged: Allows to construct from an integer in range" )
+{
+    Percent p( 200 );
+    Delta   d( -100 );
+
+    EXPECT( p.value() ==  200 );
+    EXPECT( d.value() == -100 );
+    EXPECT( to_value( p ) == 200u );
+}
+
+CASE( "ranged: Allows to compare values of the same tag with different ranges" )
+{
+    Percent a( 100 );
+    ranged< 0, 1000, struct PercentTag > b( 100 ), c( 500 );
+
+    EXPECT( ( a == b ) );
+    EXPECT( ( a != c ) );
+    EXPECT( ( a <  c ) );
+    EXPECT( ( c >= a ) );
+}
+
+CASE( "ranged: Widens the range and storage in arithmetic" )
+{
+    Percent a( 200 ), b( 200 );
+
+    auto sum  = a + b;
+    auto diff = a - b;
+    auto prod = a * b;
+    auto neg  = -a;
+
+    EXPECT( sum.lowest() == 0 ); EXPECT( sum.highest() == 400 );
+    EXPECT( diff.lowest() == -200 ); EXPECT( diff.highest() == 200 );
+    EXPECT( prod.highest() == 40000 );
+    EXPECT( neg.lowest() == -200 );
+
+    EXPECT( sizeof( sum  ) == 2u );
+    EXPECT( sizeof( prod ) == 2u );
+
+    EXPECT( sum.value()  == 400 );
+    EXPECT( diff.value() ==   0 );
+    EXPECT( prod.value() == 40000 );
+    EXPECT( neg.value()  == -200 );
+}
+
+CASE( "ranged: Allows to implicitly widen to a containing range of the same tag" )
+{
+    ranged< 0, 1000, struct PercentTag > w = Percent( 150 );
+
+    EXPECT( w.value() == 150 );
+}
+
+CASE( "ranged: Allows to explicitly narrow to a contained range of the same tag" )
+{
+    Percent p( ranged< 0, 1000, struct PercentTag >( 150 ) );
+
+    EXPECT( p.value() == 150 );
+}
+
+CASE( "ranged: Allows compound assignment and increment within the range" )
+{
+    Percent p( 10 );
+
+    p += Percent( 5 );
+    p -= Percent( 3 );
+    ++p;
+    p--;
+
+    EXPECT( p.value() == 12 );
+}
+
+CASE( "ranged: Allows constexpr construction and arithmetic (C++14)" )
+{
+#if type_CPP14_OR_GREATER
+    constexpr Percent p( 100 );
+    constexpr auto s = p + p;
+
+    static_assert( s.value() == 200, "ranged: constexpr arithmetic" );
+    EXPECT( s.value() == 200 );
+#else
+    EXPECT( !!"ranged: constexpr is not available (no C++14)" );
+#endif
+}
+
+CASE( "ranged: Disallows to mix tags or to implicitly narrow (define type_CONFIG_CONFIRMS_COMPILATION_ERRORS)" )
+{
+#if type_CONFIG_CONFIRMS_COMPILATION_ERRORS
+    Percent p = Percent( 1 ) + Percent( 1 );
+    bool b = Percent( 1 ) == Delta( 1 );
+#endif
+    EXPECT( true );
+}
+
+} // anonymous namespace
+
+#endif // type_CPP11_OR_GREATER
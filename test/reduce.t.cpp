@@ -0,0 +1,146 @@
+// Copyright 2018-2019 by Martin Moene
+//
+// https://github.com/martinmoene/type
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include "type-main.t.hpp"
+#include "nonstd/type_reduce.hpp"
+
+#if type_CPP11_OR_GREATER
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <numeric>
+#include <vector>
+
+namespace {
+
+using namespace nonstd;
+
+typedef quantity< double      , struct EnergyTag > Energy;
+typedef numeric < std::int64_t, struct CountTag  > Count;
+typedef numeric < short       , struct SmallTag  > Small;
+typedef ordered < int         , struct RankTag   > Rank;
+
+std::vector<Count> counts( std::size_t n )
+{
+    std::vector<Count> v;
+    for ( std::size_t i = 0; i != n; ++i )
+        v.push_back( Count( static_cast<std::int64_t>( ( i * 7919 ) % 1000 ) - 500 ) );
+    return v;
+}
+
+std::vector<Energy> energies( std::size_t n )
+{
+    std::vector<Energy> v;
+    for ( std::size_t i = 0; i != n; ++i )
+        v.push_back( Energy( i % 2 ? 1e-3 * double( i % 97 ) : 1e6 ) );
+    return v;
+}
+
+// -----------------------------------------------------------------------
+// reductions:
+
+CASE( "reduce: Allows to sum a range of strong values, yielding a strong value" )
+{
+    std::vector<Count> const v = counts( 100000 );
+
+    std::int64_t expected = 0;
+    for ( Count const & x : v )
+        expected += to_value( x );
+
+    EXPECT( ( strong_sum( v.begin(), v.end() ) == Count( expected ) ) );
+    EXPECT( ( std::is_same< decltype( strong_sum( v.begin(), v.end() ) ), Count >::value ) );
+}
+
+CASE( "reduce: Allows to sum an empty range, yielding zero" )
+{
+    std::vector<Energy> const v;
+
+    EXPECT( ( strong_sum( v.begin(), v.end() ) == Energy( 0.0 ) ) );
+    EXPECT( ( strong_sum_compensated( v.begin(), v.end() ) == Energy( 0.0 ) ) );
+}
+
+CASE( "reduce: Allows to sum a short range of a small underlying type" )
+{
+    std::vector<Small> const v = { Small( 1 ), Small( 2 ), Small( 3 ) };
+
+    EXPECT( ( strong_sum( v.begin(), v.end() ) == Small( 6 ) ) );
+}
+
+CASE( "reduce: Allows to sum in parallel, with a result independent of the number of threads" )
+{
+    std::vector<Energy> const v = energies( 200000 );
+
+    Energy const one = strong_sum( v.begin(), v.end(), 1 );
+
+    EXPECT( ( strong_sum( v.begin(), v.end(), 2 ) == one ) );
+    EXPECT( ( strong_sum( v.begin(), v.end(), 3 ) == one ) );
+    EXPECT( ( strong_sum( v.begin(), v.end(), 0 ) == one ) );
+    EXPECT( ( strong_sum_compensated( v.begin(), v.end(), 4 ) == strong_sum_compensated( v.begin(), v.end(), 1 ) ) );
+}
+
+CASE( "reduce: Allows compensated summation of a floating-point quantity" )
+{
+    // 1 followed by many values below half an ulp of 1:
+
+    std::vector<Energy> v( 1, Energy( 1.0 ) );
+    v.insert( v.end(), 100000, Energy( 1e-17 ) );
+
+    EXPECT( std::abs( to_value( strong_sum_compensated( v.begin(), v.end() ) ) - ( 1.0 + 1e-12 ) ) < 1e-15 );
+    EXPECT( to_value( strong_sum_compensated( v.begin(), v.end() ) ) > 1.0 );
+}
+
+CASE( "reduce: Allows to obtain the smallest, largest and both values of a range" )
+{
+    std::vector<Count> v = counts( 50000 );
+    v[ 12345 ] = Count( -1000 );
+    v[ 45678 ] = Count(  1000 );
+
+    EXPECT( ( strong_min( v.begin(), v.end() ) == Count( -1000 ) ) );
+    EXPECT( ( strong_max( v.begin(), v.end() ) == Count(  1000 ) ) );
+    EXPECT( ( strong_minmax( v.begin(), v.end(), 3 ) == std::make_pair( Count( -1000 ), Count( 1000 ) ) ) );
+}
+
+CASE( "reduce: Allows min and max of an ordered type" )
+{
+    std::vector<Rank> const v = { Rank( 3 ), Rank( 1 ), Rank( 2 ) };
+
+    EXPECT( ( strong_min( v.begin(), v.end() ) == Rank( 1 ) ) );
+    EXPECT( ( strong_max( v.begin(), v.end() ) == Rank( 3 ) ) );
+}
+
+CASE( "reduce: Allows to reduce with an associative operation, in parallel" )
+{
+    std::vector<Count> const v = counts( 100000 );
+
+    auto const larger = []( Count const & x, Count const & y ) { return x < y ? y : x; };
+
+    EXPECT( ( strong_reduce( v.begin(), v.end(), Count( -10000 ), larger, 4 ) == strong_max( v.begin(), v.end() ) ) );
+    EXPECT( ( strong_reduce( v.begin(), v.end(), Count( 0 ), std::plus<Count>(), 3 ) == strong_sum( v.begin(), v.end() ) ) );
+    EXPECT( ( strong_reduce( v.end(), v.end(), Count( 7 ), std::plus<Count>() ) == Count( 7 ) ) );
+}
+
+CASE( "reduce: Leaves unqualified calls of the standard algorithms unambiguous" )
+{
+    using namespace std;
+
+    std::vector<Count> const v = { Count( 3 ), Count( 1 ), Count( 2 ) };
+
+    EXPECT( ( *minmax_element( v.begin(), v.end() ).first == Count( 1 ) ) );
+    EXPECT( ( minmax( v.begin(), v.end() ).first == v.begin() ) );
+    EXPECT( ( accumulate( v.begin(), v.end(), Count( 0 ) ) == Count( 6 ) ) );
+#if type_CPP17_OR_GREATER
+    EXPECT( ( reduce( v.begin(), v.end(), Count( 0 ), std::plus<Count>() ) == Count( 6 ) ) );
+#endif
+}
+
+} // anonymous namespace
+
+#endif // type_CPP11_OR_GREATER
+
+// end of file
@@ -0,0 +1,124 @@
+// Copyright 2018-2019 by Martin Moene
+//
+// https://github.com/martinmoene/type
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Compiled with type_CONFIG_SAMPLE_VALUES=1, see test/CMakeLists.txt.
+
+#include "type-main.t.hpp"
+
+#if type_CONFIG_SAMPLE_VALUES
+
+#include <cstdint>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+namespace {
+
+using namespace nonstd;
+
+typedef quantity< std::int64_t, struct LatencyNsTag > LatencyNs;
+typedef numeric < double      , struct RatioTag     > Ratio;
+typedef type    < std::string , struct NameTag      > Name;
+
+value_histogram histogram_containing( char const * tag )
+{
+    std::vector<value_histogram> const all = value_histograms();
+
+    for ( std::size_t i = 0; i != all.size(); ++i )
+    {
+        if ( all[i].type_name.find( tag ) != std::string::npos )
+            return all[i];
+    }
+    return value_histogram();
+}
+
+// -----------------------------------------------------------------------
+// value sampling:
+
+CASE( "sample: Allows to sample values on construction" )
+{
+    reset_value_histograms();
+
+    LatencyNs a( 3 ), b( 3 ), c( -5 );
+
+    value_histogram const h = histogram_containing( "LatencyNsTag" );
+
+    EXPECT( h.samples == 3u );
+    EXPECT( h.buckets.size() == 2u );
+    EXPECT( h.buckets[0].negative );
+    EXPECT( h.buckets[0].lowest == 5u );
+    EXPECT( h.buckets[1].lowest == 3u );
+    EXPECT( h.buckets[1].count  == 2u );
+}
+
+CASE( "sample: Samples on construction from a value only, not on copy and assignment" )
+{
+    LatencyNs a( 1 );
+    reset_value_histograms();
+
+    LatencyNs b( 1000 );
+    LatencyNs c( b );
+    a = b;
+    a = std::move( c );
+
+    value_histogram const h = histogram_containing( "LatencyNsTag" );
+
+    EXPECT( h.samples == 1u );
+    EXPECT( h.buckets.back().lowest  <= 1000u );
+    EXPECT( h.buckets.back().highest >= 1000u );
+    EXPECT( h.buckets.back().highest - h.buckets.back().lowest < 1000u / 16 );
+}
+
+CASE( "sample: Leaves constant expressions and triviality of the types intact" )
+{
+#if type_CPP14_OR_GREATER && type_HAVE_IS_CONSTANT_EVALUATED
+    constexpr LatencyNs a( 7 );
+    static_assert( a.get() == 7, "constant expression" );
+#endif
+    static_assert( std::is_trivially_copyable< LatencyNs >::value, "trivially copyable" );
+
+    EXPECT( true );
+}
+
+CASE( "sample: Allows to sample floating point values" )
+{
+    reset_value_histograms();
+
+    Ratio r( 2.5 );
+
+    value_histogram const h = histogram_containing( "RatioTag" );
+
+    EXPECT( h.samples == 1u );
+    EXPECT( h.buckets[0].lowest == 2u );
+}
+
+CASE( "sample: Ignores non-arithmetic values" )
+{
+    reset_value_histograms();
+
+    Name n( "name" );
+
+    EXPECT( histogram_containing( "NameTag" ).samples == 0u );
+}
+
+CASE( "sample: Allows to dump the histograms" )
+{
+    reset_value_histograms();
+
+    LatencyNs a( 32 ), b( 33 );
+
+    std::ostringstream os;
+    dump_value_histograms( os );
+
+    EXPECT( os.str().find( "LatencyNsTag" ) != std::string::npos );
+    EXPECT( os.str().find( "  32 33 2\n" ) != std::string::npos );
+}
+
+} // anonymous namespace
+
+#endif // type_CONFIG_SAMPLE_VALUES
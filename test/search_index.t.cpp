@@ -0,0 +1,145 @@
+// Copyright 2018-2019 by Martin Moene
+//
+// https://github.com/martinmoene/type
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include "type-main.t.hpp"
+#include "nonstd/type_search_index.hpp"
+
+#if type_CPP11_OR_GREATER
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace {
+
+using namespace nonstd;
+
+typedef ordered< std::uint64_t, struct KeyTag > Key;
+typedef numeric< std::size_t  , struct PosTag > Pos;
+typedef search_index< Key, Pos > Index;
+
+std::vector<Key> make_keys( std::size_t n, std::uint64_t step )
+{
+    std::vector<Key> v;
+    for ( std::size_t i = 0; i != n; ++i )
+        v.push_back( Key( 10 + i * step ) );
+    return v;
+}
+
+bool agrees_with_std( std::vector<Key> const & keys, std::uint64_t limit )
+{
+    Index const index( keys.begin(), keys.end() );
+
+    for ( std::uint64_t x = 0; x <= limit; ++x )
+    {
+        std::size_t const lo = static_cast<std::size_t>( std::lower_bound( keys.begin(), keys.end(), Key( x ) ) - keys.begin() );
+        std::size_t const hi = static_cast<std::size_t>( std::upper_bound( keys.begin(), keys.end(), Key( x ) ) - keys.begin() );
+
+        if ( to_value( index.lower_bound( Key( x ) ) ) != lo ) return false;
+        if ( to_value( index.upper_bound( Key( x ) ) ) != hi ) return false;
+        if ( index.contains( Key( x ) ) != ( lo != hi ) )      return false;
+    }
+    return true;
+}
+
+// -----------------------------------------------------------------------
+// search_index:
+
+CASE( "search_index: Allows to find the lower bound of a key as a strong position" )
+{
+    std::vector<Key> keys = make_keys( 5, 10 );     // 10, 20, 30, 40, 50
+    Index index( keys.begin(), keys.end() );
+
+    EXPECT( to_value( index.lower_bound( Key(  5 ) ) ) == 0u );
+    EXPECT( to_value( index.lower_bound( Key( 20 ) ) ) == 1u );
+    EXPECT( to_value( index.lower_bound( Key( 21 ) ) ) == 2u );
+    EXPECT( to_value( index.lower_bound( Key( 60 ) ) ) == index.size() );
+}
+
+CASE( "search_index: Allows to find the upper bound of a key as a strong position" )
+{
+    std::vector<Key> keys = make_keys( 5, 10 );
+    Index index( keys.begin(), keys.end() );
+
+    EXPECT( to_value( index.upper_bound( Key(  5 ) ) ) == 0u );
+    EXPECT( to_value( index.upper_bound( Key( 20 ) ) ) == 2u );
+    EXPECT( to_value( index.upper_bound( Key( 50 ) ) ) == index.size() );
+}
+
+CASE( "search_index: Allows to check for presence of a key" )
+{
+    std::vector<Key> keys = make_keys( 5, 10 );
+    Index index( keys.begin(), keys.end() );
+
+    EXPECT(  index.contains( Key( 30 ) ) );
+    EXPECT( !index.contains( Key( 31 ) ) );
+    EXPECT( !index.contains( Key( 99 ) ) );
+}
+
+CASE( "search_index: Agrees with std::lower_bound() and std::upper_bound() for all sizes up to 130" )
+{
+    for ( std::size_t n = 0; n <= 130; ++n )
+    {
+        EXPECT( agrees_with_std( make_keys( n, 2 ), 2 * n + 12 ) );
+    }
+}
+
+CASE( "search_index: Agrees with std::lower_bound() in presence of duplicate keys" )
+{
+    std::mt19937 gen( 42 );
+    std::vector<Key> keys;
+
+    for ( int i = 0; i != 1000; ++i )
+        keys.push_back( Key( gen() % 100 ) );
+
+    std::sort( keys.begin(), keys.end() );
+
+    EXPECT( agrees_with_std( keys, 110 ) );
+}
+
+CASE( "search_index: Allows to search an empty index" )
+{
+    std::vector<Key> keys;
+    Index index( keys.begin(), keys.end() );
+
+    EXPECT( index.empty() );
+    EXPECT( to_value( index.lower_bound( Key( 7 ) ) ) == 0u );
+    EXPECT( !index.contains( Key( 7 ) ) );
+}
+
+CASE( "search_index: Agrees with std::lower_bound() for sizes around powers of two" )
+{
+    for ( std::size_t p = 256; p <= 4096; p *= 2 )
+    {
+        EXPECT( agrees_with_std( make_keys( p - 1, 2 ), 2 * p + 12 ) );
+        EXPECT( agrees_with_std( make_keys( p    , 2 ), 2 * p + 12 ) );
+        EXPECT( agrees_with_std( make_keys( p + 1, 2 ), 2 * p + 12 ) );
+    }
+}
+
+CASE( "search_index: Leaves a moved-from index empty" )
+{
+    std::vector<Key> keys = make_keys( 5, 10 );
+    Index index( keys.begin(), keys.end() );
+
+    Index other( std::move( index ) );
+
+    EXPECT( index.empty() );
+    EXPECT( to_value( index.lower_bound( Key( 20 ) ) ) == 0u );
+    EXPECT( !index.contains( Key( 20 ) ) );
+    EXPECT( to_value( other.lower_bound( Key( 20 ) ) ) == 1u );
+
+    index = std::move( other );
+
+    EXPECT( other.empty() );
+    EXPECT( index.contains( Key( 20 ) ) );
+}
+
+} // anonymous namespace
+
+#endif // type_CPP11_OR_GREATER
@@ -0,0 +1,285 @@
+// Copyright 2018-2019 by Martin Moene
+//
+// https://github.com/martinmoene/type
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include "type-main.t.hpp"
+#include "nonstd/type_slot_map.hpp"
+
+#if type_CPP11_OR_GREATER
+
+#include <algorithm>
+#include <cstdlib>
+#include <new>
+#include <string>
+
+// allocations left before operator new throws, -1: unlimited;
+// pairing the replacements with std::malloc() and std::free() is intended:
+
+#if defined __GNUC__ && ! defined __clang__ && __GNUC__ >= 11
+# pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+
+static int allocations_left = -1;
+
+void * operator new( std::size_t n )
+{
+    if ( allocations_left == 0 )
+        throw std::bad_alloc();
+
+    if ( allocations_left > 0 )
+        --allocations_left;
+
+    if ( void * p = std::malloc( n ? n : 1 ) )
+        return p;
+
+    throw std::bad_alloc();
+}
+
+void operator delete( void * p ) type_noexcept
+{
+    std::free( p );
+}
+
+#if type_CPP14_OR_GREATER
+void operator delete( void * p, std::size_t ) type_noexcept
+{
+    std::free( p );
+}
+#endif
+
+namespace {
+
+using namespace nonstd;
+
+typedef handle< struct EntityTag > Entity;
+typedef handle< struct SoundTag  > Sound;
+typedef handle< struct TinyTag, 4, std::uint8_t > Tiny;   // 4 index bits, 4 generation bits
+
+// -----------------------------------------------------------------------
+// handle:
+
+CASE( "handle: Packs index and generation into one word" )
+{
+    Entity const e( 5, 3 );
+
+    EXPECT( sizeof( Entity ) == sizeof( std::uint32_t ) );
+    EXPECT( e.index() == 5u );
+    EXPECT( e.generation() == 3u );
+    EXPECT( to_value( e ) == ( 3u << 20 | 5u ) );
+    EXPECT( Entity::max_index() == 0xFFFFFu );
+    EXPECT( Entity::max_generation() == 0xFFFu );
+}
+
+CASE( "handle: Is null when default-constructed" )
+{
+    EXPECT(   Entity().is_null() );
+    EXPECT( ! Entity( 0, 1 ).is_null() );
+}
+
+CASE( "handle: Allows to compare for equality" )
+{
+    EXPECT( ( Entity( 5, 3 ) == Entity( 5, 3 ) ) );
+    EXPECT( ( Entity( 5, 3 ) != Entity( 5, 4 ) ) );
+    EXPECT( ( Entity( 5, 3 ) != Entity( 6, 3 ) ) );
+}
+
+CASE( "handle: Disallows to mix handles of different tags" )
+{
+    EXPECT( ( std::is_convertible< Entity, Sound >::value == false ) );
+    EXPECT( ( std::is_constructible< slot_map<int, Entity>, slot_map<int, Sound> >::value == false ) );
+}
+
+// -----------------------------------------------------------------------
+// slot_map:
+
+CASE( "slot_map: Allows to insert values and look them up by handle" )
+{
+    slot_map<std::string, Entity> m;
+
+    Entity const a = m.insert( "a" );
+    Entity const b = m.emplace( 3u, 'b' );
+
+    EXPECT( m.size() == 2u );
+    EXPECT( m[a] == "a" );
+    EXPECT( m[b] == "bbb" );
+    EXPECT( *m.find( a ) == "a" );
+    EXPECT( m.contains( b ) );
+}
+
+CASE( "slot_map: Allows to erase a value, after which its handle is stale" )
+{
+    slot_map<int, Entity> m;
+
+    Entity const a = m.insert( 1 );
+    Entity const b = m.insert( 2 );
+    Entity const c = m.insert( 3 );
+
+    EXPECT( m.erase( a ) );
+    EXPECT( m.size() == 2u );
+    EXPECT( ! m.contains( a ) );
+    EXPECT( m.find( a ) == nullptr );
+    EXPECT( ! m.erase( a ) );
+    EXPECT( m[b] == 2 );
+    EXPECT( m[c] == 3 );
+}
+
+CASE( "slot_map: Allows to reuse a slot with a new generation, keeping the old handle stale" )
+{
+    slot_map<int, Entity> m;
+
+    Entity const a = m.insert( 1 );
+    m.erase( a );
+    Entity const b = m.insert( 2 );
+
+    EXPECT( b.index() == a.index() );
+    EXPECT( b.generation() == a.generation() + 1u );
+    EXPECT( ! m.contains( a ) );
+    EXPECT( m[b] == 2 );
+}
+
+CASE( "slot_map: Retires a slot whose generation is exhausted" )
+{
+    slot_map<int, Tiny> m;
+
+    Tiny first = m.insert( 0 );
+    Tiny h = first;
+
+    for ( int i = 1; i < 15; ++i )
+    {
+        m.erase( h );
+        h = m.insert( i );
+        EXPECT( h.index() == first.index() );
+    }
+
+    EXPECT( h.generation() == Tiny::max_generation() );
+
+    m.erase( h );
+    Tiny const next = m.insert( 15 );
+
+    EXPECT( next.index() != first.index() );
+    EXPECT( ! m.contains( first ) );
+    EXPECT( ! m.contains( h ) );
+}
+
+CASE( "slot_map: Yields the null handle when all handle indices are in use" )
+{
+    slot_map<int, Tiny> m;
+
+    for ( int i = 0; i <= int( Tiny::max_index() ); ++i )
+        EXPECT( ! m.insert( i ).is_null() );
+
+    Tiny const h = m.insert( 99 );
+
+    EXPECT( h.is_null() );
+    EXPECT( m.size() == Tiny::max_index() + 1u );
+    EXPECT( ( std::find( m.begin(), m.end(), 99 ) == m.end() ) );
+
+    m.erase( m.handle_at( 0 ) );
+
+    EXPECT( ! m.insert( 99 ).is_null() );
+}
+
+CASE( "slot_map: Leaves the slots unchanged when the constructor of a value throws" )
+{
+    struct fails { explicit fails( bool f ) { if ( f ) throw 42; } };
+
+    slot_map<fails, Entity> m;
+
+    EXPECT_THROWS( m.emplace( true ) );
+    EXPECT( m.empty() );
+
+    Entity const h = m.emplace( false );
+
+    EXPECT( h.index() == 0u );
+    EXPECT( h.generation() == 1u );
+}
+
+CASE( "slot_map: Leaves the map unchanged when an allocation fails" )
+{
+    for ( int n = 0; n != 4; ++n )
+    {
+        slot_map<int, Entity> m;
+
+        Entity const a = m.insert( 1 );
+        bool threw = false;
+
+        allocations_left = n;
+        try { m.insert( 2 ); } catch ( std::bad_alloc const & ) { threw = true; }
+        allocations_left = -1;
+
+        if ( ! threw )
+            continue;
+
+        EXPECT( m.size() == 1u );
+        EXPECT( ( m.handle_at( 0 ) == a ) );
+        EXPECT( m[a] == 1 );
+
+        Entity const b = m.insert( 2 );
+
+        EXPECT( m.size() == 2u );
+        EXPECT( ( m.handle_at( 1 ) == b ) );
+        EXPECT( m[b] == 2 );
+    }
+}
+
+CASE( "slot_map: Rejects the null handle" )
+{
+    slot_map<int, Entity> m;
+
+    m.insert( 1 );
+
+    EXPECT( ! m.contains( Entity() ) );
+    EXPECT( ! m.erase( Entity() ) );
+}
+
+CASE( "slot_map: Allows dense iteration over the values, and to obtain the handle per position" )
+{
+    slot_map<int, Entity> m;
+
+    Entity const a = m.insert( 1 );
+    Entity const b = m.insert( 2 );
+    Entity const c = m.insert( 3 );
+
+    m.erase( a );
+
+    std::vector<int> v( m.begin(), m.end() );
+    std::sort( v.begin(), v.end() );
+
+    EXPECT( ( v == std::vector<int>{ 2, 3 } ) );
+    EXPECT( m.end() - m.begin() == 2 );
+
+    for ( std::size_t pos = 0; pos != m.size(); ++pos )
+    {
+        Entity const h = m.handle_at( pos );
+        EXPECT( ( h == b || h == c ) );
+        EXPECT( &m[h] == m.data() + pos );
+    }
+}
+
+CASE( "slot_map: Allows to clear, invalidating all handles" )
+{
+    slot_map<int, Entity> m;
+
+    Entity const a = m.insert( 1 );
+    Entity const b = m.insert( 2 );
+
+    m.clear();
+
+    EXPECT( m.empty() );
+    EXPECT( ! m.contains( a ) );
+    EXPECT( ! m.contains( b ) );
+
+    Entity const c = m.insert( 3 );
+
+    EXPECT( ( c != a && c != b ) );
+    EXPECT( m[c] == 3 );
+}
+
+} // anonymous namespace
+
+#endif // type_CPP11_OR_GREATER
+
+// end of file
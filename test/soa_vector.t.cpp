@@ -0,0 +1,169 @@
+// Copyright 2018-2019 by Martin Moene
+//
+// https://github.com/martinmoene/type
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include "type-main.t.hpp"
+#include "nonstd/type_soa_vector.hpp"
+
+#if type_CPP11_OR_GREATER
+
+#include <cstdint>
+#include <numeric>
+
+namespace {
+
+using namespace nonstd;
+
+typedef equality< std::uint64_t, struct OrderIdTag   > OrderId;
+typedef quantity< std::int64_t , struct PriceTag     > Price;
+typedef numeric < std::int64_t , struct QuantityTag  > Quantity;
+typedef ordered < std::uint64_t, struct TimestampTag > Timestamp;
+
+typedef soa_vector< OrderId, Price, Quantity, Timestamp > Orders;
+
+Orders make_orders( int n )
+{
+    Orders orders;
+
+    for ( int i = 0; i != n; ++i )
+        orders.push_back( OrderId( std::uint64_t( i ) ), Price( 100 + i ), Quantity( i ), Timestamp( std::uint64_t( 1000 + i ) ) );
+
+    return orders;
+}
+
+// -----------------------------------------------------------------------
+// soa_vector:
+
+CASE( "soa_vector: Allows to append records and to access fields by type" )
+{
+    Orders orders = make_orders( 3 );
+
+    EXPECT( orders.size() == 3u );
+    EXPECT( to_value( orders.get<Price>( 1 ) ) == 101 );
+    EXPECT( to_value( orders.get<Timestamp>( 2 ) ) == 1002u );
+}
+
+CASE( "soa_vector: Stores each field in its own contiguous array" )
+{
+    Orders orders = make_orders( 10 );
+
+    Quantity const * q = orders.data<Quantity>();
+
+    EXPECT( q + 9 == &orders.get<Quantity>( 9 ) );
+    EXPECT( orders.column<Price>().size() == 10u );
+}
+
+CASE( "soa_vector: Allows to scan a single field" )
+{
+    Orders orders = make_orders( 100 );
+
+    std::vector<Quantity> const & q = orders.column<Quantity>();
+
+    EXPECT( to_value( std::accumulate( q.begin(), q.end(), Quantity( 0 ) ) ) == 4950 );
+}
+
+CASE( "soa_vector: Allows to access and modify a record via a row proxy" )
+{
+    using std::get;     // get<F>(row) is found via ADL, see soa_row
+
+    Orders orders = make_orders( 3 );
+
+    orders[1].get<Price>() = Price( 7 );
+    get<Quantity>( orders[1] ) += Quantity( 5 );
+
+    EXPECT( to_value( get<Price>( orders[1] ) ) == 7 );
+    EXPECT( to_value( orders[1].get<Quantity>() ) == 6 );
+}
+
+CASE( "soa_vector: Allows to copy a record as a tuple" )
+{
+    Orders orders = make_orders( 3 );
+
+    Orders::value_type r = orders[2];
+    orders[0] = r;
+
+    EXPECT( ( orders.get<OrderId>( 0 ) == OrderId( 2 ) ) );
+    EXPECT( to_value( std::get<1>( r ) ) == 102 );
+}
+
+CASE( "soa_vector: Allows to iterate over the records" )
+{
+    Orders const orders = make_orders( 10 );
+
+    std::int64_t sum = 0;
+    for ( auto row : orders )
+        sum += to_value( row.get<Price>() ) * to_value( row.get<Quantity>() );
+
+    EXPECT( sum == 100 * 45 + 285 );
+    EXPECT( orders.end() - orders.begin() == 10 );
+}
+
+CASE( "soa_vector: Allows to resize, reserve and clear" )
+{
+    Orders orders;
+
+    orders.reserve( 10 );
+    orders.resize( 5 );
+
+    EXPECT( orders.size() == 5u );
+    EXPECT( orders.column<Timestamp>().size() == 5u );
+
+    orders.clear();
+
+    EXPECT( orders.empty() );
+}
+
+CASE( "soa_vector: Allows to clear fields that are not default-constructible" )
+{
+    typedef ordered< int, struct LevelTag, no_default_t > Level;
+
+    soa_vector< OrderId, Level > levels;
+
+    levels.push_back( OrderId( 1 ), Level( 3 ) );
+    levels.clear();
+
+    EXPECT( levels.empty() );
+    EXPECT( levels.column<Level>().empty() );
+}
+
+CASE( "soa_vector: Leaves all fields unchanged when copying a field throws" )
+{
+    struct Fragile
+    {
+        explicit Fragile( bool f ) : fails( f ) {}
+        Fragile( Fragile const & other ) : fails( other.fails ) { if ( fails ) throw 42; }
+        bool fails;
+    };
+
+    soa_vector< OrderId, Fragile, Price > v;
+
+    v.push_back( OrderId( 1 ), Fragile( false ), Price( 2 ) );
+
+    std::tuple< OrderId, Fragile, Price > record( OrderId( 3 ), Fragile( false ), Price( 4 ) );
+    std::get<1>( record ).fails = true;
+
+    EXPECT_THROWS( v.push_back( OrderId( 3 ), Fragile( true ), Price( 4 ) ) );
+    EXPECT_THROWS( v.push_back( record ) );
+
+    EXPECT( v.size() == 1u );
+    EXPECT( v.column<OrderId>().size() == 1u );
+    EXPECT( v.column<Fragile>().size() == 1u );
+    EXPECT( v.column<Price  >().size() == 1u );
+}
+
+CASE( "soa_vector: Disallows duplicate field types and access to absent fields (define type_CONFIG_CONFIRMS_COMPILATION_ERRORS)" )
+{
+#if type_CONFIG_CONFIRMS_COMPILATION_ERRORS
+    soa_vector< Price, Price > duplicate;
+    typedef numeric< int, struct VolumeTag > Volume;
+    make_orders( 1 ).get<Volume>( 0 );
+#endif
+    EXPECT( true );
+}
+
+} // anonymous namespace
+
+#endif // type_CPP11_OR_GREATER
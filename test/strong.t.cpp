@@ -0,0 +1,163 @@
+// Copyright 2018-2019 by Martin Moene
+//
+// https://github.com/martinmoene/type
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include "type-main.t.hpp"
+#include "nonstd/type_strong.hpp"
+
+#if type_CPP11_OR_GREATER
+
+namespace {
+
+using namespace nonstd;
+
+typedef strong< int   , struct MeterTag, skill::equality, skill::ordered, skill::addition, skill::subtraction, skill::increment > Meter;
+typedef strong< double, struct MassTag , skill::equality, skill::addition, skill::negation, skill::scaling > Mass;
+typedef strong< int   , struct CountTag, skill::equality, skill::multiplication, skill::division, skill::modulus > Count;
+typedef strong< unsigned, struct MaskTag, skill::equality, skill::bitwise, skill::shift > Mask;
+typedef strong< bool  , struct FlagTag , skill::equality, skill::logical > Flag;
+
+typedef numeric< int, struct MeterTag > MeterNumeric;
+
+// -----------------------------------------------------------------------
+// strong:
+
+CASE( "strong: Has the size of its underlying type" )
+{
+    EXPECT( sizeof( Meter ) == sizeof( int ) );
+    EXPECT( sizeof( Mass  ) == sizeof( double ) );
+}
+
+CASE( "strong: Allows to default-construct and to construct from its underlying type" )
+{
+    EXPECT( to_value( Meter()  ) == 0 );
+    EXPECT( to_value( Meter(7) ) == 7 );
+}
+
+CASE( "strong: Allows to compare with skills equality and ordered" )
+{
+    EXPECT( ( Meter(7) == Meter(7) ) );
+    EXPECT( ( Meter(7) != Meter(8) ) );
+    EXPECT( ( Meter(7) <  Meter(8) ) );
+    EXPECT( ( Meter(7) <= Meter(7) ) );
+    EXPECT( ( Meter(8) >  Meter(7) ) );
+    EXPECT( ( Meter(8) >= Meter(8) ) );
+}
+
+CASE( "strong: Allows to three-way compare with skill ordered (C++20)" )
+{
+#if type_HAVE_THREE_WAY_COMPARISON
+    EXPECT( ( ( Meter(1) <=> Meter(2) ) <  0 ) );
+    EXPECT( ( ( Meter(2) <=> Meter(2) ) == 0 ) );
+#else
+    EXPECT( !!"strong: three-way comparison is not available (no C++20)" );
+#endif
+}
+
+CASE( "strong: Allows to add, subtract, increment with skills addition, subtraction, increment" )
+{
+    Meter m( 5 );
+
+    EXPECT( ( m + Meter(2) == Meter(7) ) );
+    EXPECT( ( m - Meter(2) == Meter(3) ) );
+    EXPECT( ( +m == Meter(5) ) );
+    EXPECT( ( ( m += Meter(1) ) == Meter(6) ) );
+    EXPECT( ( ( m -= Meter(2) ) == Meter(4) ) );
+    EXPECT( ( ++m == Meter(5) ) );
+    EXPECT( ( m++ == Meter(5) ) );
+    EXPECT( ( --m == Meter(5) ) );
+    EXPECT( ( m-- == Meter(5) ) );
+    EXPECT( ( m == Meter(4) ) );
+}
+
+CASE( "strong: Allows to multiply, divide, take modulus with skills multiplication, division, modulus" )
+{
+    Count c( 7 );
+
+    EXPECT( ( c * Count(3) == Count(21) ) );
+    EXPECT( ( c / Count(2) == Count( 3) ) );
+    EXPECT( ( c % Count(4) == Count( 3) ) );
+    EXPECT( ( ( c *= Count(2) ) == Count(14) ) );
+    EXPECT( ( ( c /= Count(7) ) == Count( 2) ) );
+    EXPECT( ( ( c %= Count(2) ) == Count( 0) ) );
+}
+
+CASE( "strong: Allows to scale by the underlying type and to negate with skills scaling, negation" )
+{
+    Mass m( 1.5 );
+
+    EXPECT( ( m * 2.0 == Mass(3.0) ) );
+    EXPECT( ( 2.0 * m == Mass(3.0) ) );
+    EXPECT( ( m / 2.0 == Mass(0.75) ) );
+    EXPECT( ( Mass(3.0) / m == 2.0 ) );
+    EXPECT( ( -m == Mass(-1.5) ) );
+    EXPECT( ( ( m *= 4.0 ) == Mass(6.0) ) );
+    EXPECT( ( ( m /= 3.0 ) == Mass(2.0) ) );
+}
+
+CASE( "strong: Allows bit manipulation with skills bitwise, shift" )
+{
+    Mask m( 0x0Fu );
+
+    EXPECT( ( ( m & Mask(0x3Cu) ) == Mask(0x0Cu) ) );
+    EXPECT( ( ( m | Mask(0x30u) ) == Mask(0x3Fu) ) );
+    EXPECT( ( ( m ^ Mask(0x3Cu) ) == Mask(0x33u) ) );
+    EXPECT( ( ~m == Mask(~0x0Fu) ) );
+    EXPECT( ( ( m << 4 ) == Mask(0xF0u) ) );
+    EXPECT( ( ( m >> 2 ) == Mask(0x03u) ) );
+    EXPECT( ( ( m <<= 4 ) == Mask(0xF0u) ) );
+    EXPECT( ( ( m >>= 6 ) == Mask(0x03u) ) );
+}
+
+CASE( "strong: Allows logical operations with skill logical" )
+{
+    EXPECT( ( (!Flag(false)) == Flag(true) ) );
+    EXPECT( ( ( Flag(true) && Flag(false) ) == Flag(false) ) );
+    EXPECT( ( ( Flag(true) || Flag(false) ) == Flag(true) ) );
+}
+
+CASE( "strong: Allows to convert explicitly from and to a family type with the same underlying type and tag" )
+{
+    MeterNumeric n( 7 );
+    Meter        m( n );
+
+    EXPECT( ( m == Meter(7) ) );
+    EXPECT( ( MeterNumeric( m ) == n ) );
+    EXPECT( ( std::is_convertible< Meter, MeterNumeric >::value == false ) );
+    EXPECT( ( std::is_convertible< MeterNumeric, Meter >::value == false ) );
+}
+
+CASE( "strong: Allows to use the free functions of type" )
+{
+    Meter a( 1 ), b( 2 );
+
+    swap( a, b );
+
+    EXPECT( to_value( a ) == 2 );
+    EXPECT( make_hash( a ) == make_hash( MeterNumeric( 2 ) ) );
+}
+
+CASE( "strong: Satisfies the concepts according to its skills (C++20)" )
+{
+#if type_USES_CONCEPTS
+    typedef strong< int, struct NumTag, skill::equality, skill::ordered, skill::addition, skill::subtraction,
+        skill::multiplication, skill::division, skill::negation > Numeric;
+
+    EXPECT(   strong_type    < Meter   > );
+    EXPECT(   strong_ordered < Meter   > );
+    EXPECT( ! strong_numeric < Meter   > );
+    EXPECT(   strong_numeric < Numeric > );
+    EXPECT( ! strong_ordered < Count   > );
+#else
+    EXPECT( !!"type: concepts are not available (no C++20)" );
+#endif
+}
+
+} // anonymous namespace
+
+#endif // type_CPP11_OR_GREATER
+
+// end of file
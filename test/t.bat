@@ -28,7 +28,7 @@ set msvc_defines=^
 
 set CppCoreCheckInclude=%VCINSTALLDIR%\Auxiliary\VS\include
 
-cl -nologo -W3 -EHsc %std% %unit_select% %unit_config% %msvc_defines% -I"%CppCoreCheckInclude%" -Ilest -I../include -I. %unit%-main.t.cpp %unit%.t.cpp && %unit%-main.t.exe
+cl -nologo -W3 -EHsc %std% %unit_select% %unit_config% %msvc_defines% -I"%CppCoreCheckInclude%" -Ilest -I../include -I. %unit%-main.t.cpp %unit%.t.cpp irange.t.cpp arena.t.cpp offset_ptr.t.cpp radix_sort.t.cpp search_index.t.cpp delta_sequence.t.cpp varint.t.cpp ranged.t.cpp packed_array.t.cpp soa_vector.t.cpp fwd.t.cpp strong.t.cpp mixed.t.cpp fixed_point.t.cpp tsc.t.cpp slot_map.t.cpp compact_optional.t.cpp reduce.t.cpp execution.t.cpp transparent.t.cpp && %unit%-main.t.exe
 endlocal & goto :EOF
 
 :: subroutines:
@@ -34,7 +34,7 @@ rem -flto / -fwhole-program
 set  optflags=-O2
 set warnflags=-Wall -Wextra -Wpedantic -Weverything -Wshadow -Wno-c++98-compat -Wno-c++98-compat-pedantic -Wno-padded -Wno-missing-noreturn -Wno-documentation-unknown-command -Wno-documentation-deprecated-sync -Wno-documentation -Wno-weak-vtables -Wno-missing-prototypes -Wno-missing-variable-declarations -Wno-exit-time-destructors -Wno-global-constructors -Wno-sign-conversion -Wno-sign-compare -Wno-implicit-int-conversion -Wno-deprecated-declarations -Wno-date-time
 
-"%clang%" -EHsc -std:%std% %optflags% %warnflags% %unit_config% -fms-compatibility-version=19.00 /imsvc lest -I../include -Ics_string -I. -o %unit_file%-main.t.exe %unit_file%-main.t.cpp %unit_file%.t.cpp && %unit_file%-main.t.exe
+"%clang%" -EHsc -std:%std% %optflags% %warnflags% %unit_config% -fms-compatibility-version=19.00 /imsvc lest -I../include -Ics_string -I. -o %unit_file%-main.t.exe %unit_file%-main.t.cpp %unit_file%.t.cpp irange.t.cpp arena.t.cpp offset_ptr.t.cpp radix_sort.t.cpp search_index.t.cpp delta_sequence.t.cpp varint.t.cpp ranged.t.cpp packed_array.t.cpp soa_vector.t.cpp fwd.t.cpp strong.t.cpp mixed.t.cpp fixed_point.t.cpp tsc.t.cpp slot_map.t.cpp compact_optional.t.cpp reduce.t.cpp execution.t.cpp transparent.t.cpp && %unit_file%-main.t.exe
 endlocal & goto :EOF
 
 :: subroutines:
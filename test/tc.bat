@@ -28,7 +28,7 @@ rem -flto / -fwhole-program
 set  optflags=-O2
 set warnflags=-Wall -Wextra -Wpedantic -Weverything -Wno-c++98-compat -Wno-c++98-compat-pedantic -Wno-padded -Wno-missing-noreturn -Wno-documentation-unknown-command -Wno-documentation-deprecated-sync -Wno-documentation -Wno-weak-vtables -Wno-missing-prototypes -Wno-missing-variable-declarations -Wno-exit-time-destructors -Wno-global-constructors
 
-"%clang%" -m32 -std=%std% %optflags% %warnflags% %unit_select% %unit_config% -fms-compatibility-version=19.00 -isystem "%VCInstallDir%include" -isystem "%WindowsSdkDir_71A%include" -isystem lest -I../include -o %unit%-main.t.exe %unit%-main.t.cpp %unit%.t.cpp && %unit%-main.t.exe
+"%clang%" -m32 -std=%std% %optflags% %warnflags% %unit_select% %unit_config% -fms-compatibility-version=19.00 -isystem "%VCInstallDir%include" -isystem "%WindowsSdkDir_71A%include" -isystem lest -I../include -o %unit%-main.t.exe %unit%-main.t.cpp %unit%.t.cpp irange.t.cpp arena.t.cpp offset_ptr.t.cpp radix_sort.t.cpp search_index.t.cpp delta_sequence.t.cpp varint.t.cpp ranged.t.cpp packed_array.t.cpp soa_vector.t.cpp fwd.t.cpp strong.t.cpp mixed.t.cpp fixed_point.t.cpp tsc.t.cpp slot_map.t.cpp compact_optional.t.cpp reduce.t.cpp execution.t.cpp transparent.t.cpp && %unit%-main.t.exe
 endlocal & goto :EOF
 
 :: subroutines:
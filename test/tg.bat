@@ -29,7 +29,7 @@ rem -flto / -fwhole-program
 set  optflags=-O2
 set warnflags=-Wall -Wextra -Wpedantic -Wconversion -Wsign-conversion -Wno-padded -Wno-missing-noreturn
 
-%gpp% -std=%std% %optflags% %warnflags% %unit_select% %unit_config% -o %unit%-main.t.exe -isystem lest -I../include %unit%-main.t.cpp %unit%.t.cpp && %unit%-main.t.exe
+%gpp% -std=%std% %optflags% %warnflags% %unit_select% %unit_config% -o %unit%-main.t.exe -isystem lest -I../include %unit%-main.t.cpp %unit%.t.cpp irange.t.cpp arena.t.cpp offset_ptr.t.cpp radix_sort.t.cpp search_index.t.cpp delta_sequence.t.cpp varint.t.cpp ranged.t.cpp packed_array.t.cpp soa_vector.t.cpp fwd.t.cpp strong.t.cpp mixed.t.cpp fixed_point.t.cpp tsc.t.cpp slot_map.t.cpp compact_optional.t.cpp reduce.t.cpp execution.t.cpp transparent.t.cpp && %unit%-main.t.exe
 
 endlocal & goto :EOF
 
@@ -0,0 +1,115 @@
+// Copyright 2018-2019 by Martin Moene
+//
+// https://github.com/martinmoene/type
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include "type-main.t.hpp"
+#include "nonstd/type_transparent.hpp"
+
+#ifndef  type_CONFIG_CONFIRMS_COMPILATION_ERRORS
+# define type_CONFIG_CONFIRMS_COMPILATION_ERRORS  0
+#endif
+
+#if type_CPP17_OR_GREATER
+
+#include <map>
+#include <set>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+
+namespace {
+
+using namespace nonstd;
+
+typedef equality< std::string, struct UserTag  > User;
+typedef ordered < std::string, struct TopicTag > Topic;
+
+typedef strong_view< User  >::type UserView;
+typedef strong_view< Topic >::type TopicView;
+
+typedef std::unordered_map< User, int, transparent_hash<User>, transparent_equal_to<User> > UserMap;
+
+CASE( "transparent: Allows to obtain the strong string_view type of a strong string type" )
+{
+    EXPECT( ( std::is_same< UserView , equality< std::string_view, UserTag  > >::value ) );
+    EXPECT( ( std::is_same< TopicView, ordered < std::string_view, TopicTag > >::value ) );
+
+    EXPECT( ( std::is_same< strong_view< ordered< std::string, TopicTag, no_default_t > >::type, ordered< std::string_view, TopicTag, no_default_t > >::value ) );
+}
+
+CASE( "transparent: Allows to hash a strong string and its strong view alike" )
+{
+    transparent_hash<User> hash;
+
+    EXPECT( hash( User( "alice" ) ) == hash( UserView( "alice" ) ) );
+    EXPECT( hash( User( "alice" ) ) == std::hash<std::string>()( "alice" ) );
+}
+
+CASE( "transparent: Allows to compare a strong string and its strong view for equality" )
+{
+    transparent_equal_to<User> eq;
+
+    EXPECT(     eq( User( "alice" ), UserView( "alice" ) ) );
+    EXPECT(     eq( UserView( "alice" ), User( "alice" ) ) );
+    EXPECT_NOT( eq( User( "alice" ), UserView( "bob" ) ) );
+    EXPECT(     eq( User( "bob" ), User( "bob" ) ) );
+}
+
+CASE( "transparent: Allows to compare a strong string and its strong view for order" )
+{
+    transparent_less<Topic> lt;
+
+    EXPECT(     lt( Topic( "a" ), TopicView( "b" ) ) );
+    EXPECT(     lt( TopicView( "a" ), Topic( "b" ) ) );
+    EXPECT_NOT( lt( Topic( "b" ), TopicView( "a" ) ) );
+    EXPECT_NOT( lt( Topic( "a" ), Topic( "a" ) ) );
+}
+
+CASE( "transparent: Allows heterogeneous lookup in an unordered_map with a strong view (C++20)" )
+{
+#if defined( __cpp_lib_generic_unordered_lookup )
+    UserMap users;
+    users.emplace( User( "alice" ), 1 );
+    users.emplace( User( "bob"   ), 2 );
+
+    std::string_view const parsed = "name=bob";
+
+    EXPECT( users.find( UserView( parsed.substr( 5 ) ) )->second == 2 );
+    EXPECT( users.count( UserView( "alice" ) ) == 1u );
+    EXPECT( ( users.find( UserView( "carol" ) ) == users.end() ) );
+#else
+    EXPECT( !!"transparent: heterogeneous lookup in unordered containers is not available (no C++20)" );
+#endif
+}
+
+CASE( "transparent: Allows heterogeneous lookup in a map and a set with a strong view" )
+{
+    std::map< Topic, int, transparent_less<Topic> > topics;
+    topics.emplace( Topic( "news" ), 1 );
+    topics.emplace( Topic( "sport" ), 2 );
+
+    std::set< Topic, transparent_less<Topic> > const names = { Topic( "a" ), Topic( "c" ) };
+
+    EXPECT( topics.find( TopicView( "sport" ) )->second == 2 );
+    EXPECT( ( topics.find( TopicView( "weather" ) ) == topics.end() ) );
+    EXPECT( names.lower_bound( TopicView( "b" ) )->get() == "c" );
+}
+
+CASE( "transparent: Disallows lookup with a view of another tag (define type_CONFIG_CONFIRMS_COMPILATION_ERRORS)" )
+{
+#if type_CONFIG_CONFIRMS_COMPILATION_ERRORS
+    UserMap users;
+    users.find( TopicView( "alice" ) );
+#endif
+    EXPECT( true );
+}
+
+} // anonymous namespace
+
+#endif // type_CPP17_OR_GREATER
+
+// end of file
@@ -0,0 +1,73 @@
+// Copyright 2018-2019 by Martin Moene
+//
+// https://github.com/martinmoene/type
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include "type-main.t.hpp"
+#include "nonstd/type_tsc.hpp"
+
+#if type_CPP11_OR_GREATER
+
+#include <thread>
+
+namespace {
+
+using namespace nonstd;
+
+template< typename X, typename Y, typename = void >
+struct can_add : std::false_type {};
+
+template< typename X, typename Y >
+struct can_add< X, Y, decltype( void( std::declval<X>() + std::declval<Y>() ) ) > : std::true_type {};
+
+// -----------------------------------------------------------------------
+// tsc_point, tsc_duration:
+
+CASE( "tsc: Allows difference arithmetic of time-stamp counter readings in ticks" )
+{
+    tsc_point    const p( 1000 );
+    tsc_duration const d( 250 );
+
+    EXPECT( ( p + d == tsc_point( 1250 ) ) );
+    EXPECT( ( d + p == tsc_point( 1250 ) ) );
+    EXPECT( ( p - d == tsc_point(  750 ) ) );
+    EXPECT( ( ( p + d ) - p == d ) );
+    EXPECT( ( d + d == tsc_duration( 500 ) ) );
+    EXPECT( ( std::is_same< decltype( p - p ), tsc_duration >::value ) );
+    EXPECT( ( can_add< tsc_point, tsc_point >::value == false ) );
+}
+
+CASE( "tsc: Has the size of a 64-bit integer" )
+{
+    EXPECT( sizeof( tsc_point    ) == sizeof( std::int64_t ) );
+    EXPECT( sizeof( tsc_duration ) == sizeof( std::int64_t ) );
+}
+
+CASE( "tsc: Allows to read the time-stamp counter, which does not decrease" )
+{
+    tsc_point const t0 = tsc_now();
+    tsc_point const t1 = tsc_now();
+
+    EXPECT( ( t0 <= t1 ) );
+}
+
+CASE( "tsc: Allows to convert a duration in ticks to nanoseconds after calibration" )
+{
+    EXPECT( tsc_ticks_per_ns() > 0.0 );
+
+    tsc_point const t0 = tsc_now();
+    std::this_thread::sleep_for( std::chrono::milliseconds( 5 ) );
+    tsc_duration const d = tsc_now() - t0;
+
+    EXPECT( to_nanoseconds( d ) > 4e6 );
+    EXPECT( ( to_duration( d ) > std::chrono::milliseconds( 4 ) ) );
+    EXPECT( to_nanoseconds( tsc_duration( 0 ) ) == 0.0 );
+}
+
+} // anonymous namespace
+
+#endif // type_CPP11_OR_GREATER
+
+// end of file
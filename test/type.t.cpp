@@ -11,6 +11,8 @@
 #include <cstddef>
 #include <cmath>
 #include <cstdlib>
+#include <string>
+#include <utility>
 #include <vector>
 
 #ifndef  type_CONFIG_CONFIRMS_COMPILATION_ERRORS
@@ -194,6 +196,25 @@ CASE( "type: Allows to custom-default-construct a type thus defined" )
     EXPECT( to_value( x ) == 5 );
 }
 
+CASE( "type: Allows constant expressions and is trivially copyable, also when instrumented (C++14)" )
+{
+#if type_CPP14_OR_GREATER && ( ! type_HAVE_INSTRUMENTATION || type_HAVE_IS_CONSTANT_EVALUATED )
+    typedef numeric< int, struct ConstantTag > Number;
+
+    constexpr Number a( 1 ), b( 2 );
+    constexpr Number zero;
+
+    STATIC_ASSERT( ( a + b ).get() == 3 );
+    STATIC_ASSERT( a < b );
+    STATIC_ASSERT( zero.get() == 0 );
+    STATIC_ASSERT( std::is_trivially_copyable< Number >::value );
+
+    EXPECT( to_value( a + b ) == 3 );
+#else
+    EXPECT( !!"type: constant expressions are not available (no C++14, or instrumented without a test for constant evaluation)" );
+#endif
+}
+
 CASE( "type: Allows to copy-construct a type from its underlying type" )
 {
     CopyMoveType x( CopyMove(7) );
@@ -757,6 +778,56 @@ CASE( "ordered: Allows to compare an ordered for order" )
     EXPECT_NOT( x >= y );
 }
 
+CASE( "ordered: Allows to three-way compare an ordered (C++20)" )
+{
+#if type_HAVE_THREE_WAY_COMPARISON
+    typedef ordered < std::string, struct NameTag > Name;
+    typedef quantity< double     , struct MassTag > Mass;
+
+    EXPECT( ( ( Ordered( 7) <=> Ordered(42) ) <  0 ) );
+    EXPECT( ( ( Ordered(42) <=> Ordered(42) ) == 0 ) );
+    EXPECT( ( ( Name("abc") <=> Name("abd") ) <  0 ) );
+    EXPECT( ( ( Mass(2.0)   <=> Mass(1.0)   ) >  0 ) );
+
+    EXPECT( ( std::is_same< decltype( Name() <=> Name() ), std::strong_ordering  >::value ) );
+    EXPECT( ( std::is_same< decltype( Mass() <=> Mass() ), std::partial_ordering >::value ) );
+#else
+    EXPECT( !!"ordered: three-way comparison is not available (no C++20)" );
+#endif
+}
+
+CASE( "ordered: Allows to three-way compare a pair and a struct with ordered members (C++20)" )
+{
+#if type_HAVE_THREE_WAY_COMPARISON
+    typedef ordered< std::string, struct NameTag > Name;
+
+    struct Key
+    {
+        Name    name;
+        Ordered rank;
+
+        auto operator<=>( Key const & ) const = default;
+        bool operator== ( Key const & ) const = default;
+    };
+
+    EXPECT( ( std::make_pair( Name("ab"), Ordered(1) ) < std::make_pair( Name("ab"), Ordered(2) ) ) );
+    EXPECT( ( ( Key{ Name("ab"), Ordered(1) } <=> Key{ Name("ab"), Ordered(2) } ) < 0 ) );
+    EXPECT( ( Key{ Name("b"), Ordered(1) } > Key{ Name("ab"), Ordered(2) } ) );
+#else
+    EXPECT( !!"ordered: three-way comparison is not available (no C++20)" );
+#endif
+}
+
+CASE( "ordered: Allows to omit three-way comparison for an underlying type without it (C++20)" )
+{
+#if type_HAVE_THREE_WAY_COMPARISON
+    EXPECT(   std::three_way_comparable< Ordered > );
+    EXPECT( ! std::three_way_comparable< CopyMoveOrdered > );
+#else
+    EXPECT( !!"ordered: three-way comparison is not available (no C++20)" );
+#endif
+}
+
 CASE( "ordered: Allows to obtain hash of an ordered object (C++11)" )
 {
 #if type_CPP11_OR_GREATER
@@ -1293,6 +1364,70 @@ CASE( "offset: Allows to obtain hash of an offset object (C++11)" )
 #endif
 }
 
+// -----------------------------------------------------------------------
+// concepts:
+
+#if type_USES_CONCEPTS
+
+template< strong_numeric S >
+S twice( S const & x ) { return x + x; }
+
+template< typename S >
+int twice( S const & ) { return 0; }
+
+#endif
+
+CASE( "concepts: Allows to recognize a strong type and its family (C++20)" )
+{
+#if type_USES_CONCEPTS
+    typedef numeric < int   , struct ConceptTag > Numeric;
+    typedef quantity< double, struct ConceptTag > Quantity;
+    typedef ordered < int   , struct ConceptTag > Ordered;
+    typedef equality< int   , struct ConceptTag > Equality;
+
+    struct Sub : Numeric { Sub() {} };
+
+    EXPECT(   strong_type<Numeric>  );
+    EXPECT(   strong_type<Sub>      );
+    EXPECT( ! strong_type<int>      );
+
+    EXPECT(   strong_numeric <Numeric>  );
+    EXPECT( ! strong_numeric <Quantity> );
+    EXPECT(   strong_quantity<Quantity> );
+    EXPECT(   strong_ordered <Ordered>  );
+    EXPECT( ! strong_numeric <Ordered>  );
+    EXPECT(   strong_equality<Equality> );
+    EXPECT( ! strong_ordered <Equality> );
+#else
+    EXPECT( !!"type: concepts are not available (no C++20)" );
+#endif
+}
+
+CASE( "concepts: Allows to constrain a function template to a family (C++20)" )
+{
+#if type_USES_CONCEPTS
+    typedef numeric< int, struct ConceptTag > Numeric;
+    typedef ordered< int, struct ConceptTag > Ordered;
+
+    EXPECT( ( twice( Numeric( 3 ) ) == Numeric( 6 ) ) );
+    EXPECT(   twice( Ordered( 3 ) ) == 0 );
+#else
+    EXPECT( !!"type: concepts are not available (no C++20)" );
+#endif
+}
+
+CASE( "concepts: Disallows default construction with no_default_t via a requires-clause (C++20)" )
+{
+#if type_USES_CONCEPTS
+    EXPECT( ! default_policy< no_default_t > );
+    EXPECT(   default_policy< int > );
+    EXPECT( ! ( std::is_default_constructible< numeric< int, struct ConceptTag, no_default_t > >::value ) );
+    EXPECT(   ( std::is_default_constructible< numeric< int, struct ConceptTag > >::value ) );
+#else
+    EXPECT( !!"type: concepts are not available (no C++20)" );
+#endif
+}
+
 // -----------------------------------------------------------------------
 // macros:
 
@@ -0,0 +1,135 @@
+// Copyright 2018-2019 by Martin Moene
+//
+// https://github.com/martinmoene/type
+//
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include "type-main.t.hpp"
+#include "nonstd/type_varint.hpp"
+
+#if type_CPP11_OR_GREATER
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace {
+
+using namespace nonstd;
+
+typedef numeric< std::int32_t , struct PriceTag > Price;
+typedef numeric< std::uint64_t, struct IdTag    > Id;
+typedef numeric< std::int8_t  , struct TinyTag  > Tiny;
+
+// -----------------------------------------------------------------------
+// varint:
+
+CASE( "varint: Allows to zigzag-encode and -decode signed values" )
+{
+    EXPECT( zigzag_encode(  0 ) == 0u );
+    EXPECT( zigzag_encode( -1 ) == 1u );
+    EXPECT( zigzag_encode(  1 ) == 2u );
+    EXPECT( zigzag_encode( -2 ) == 3u );
+    EXPECT( zigzag_encode( INT64_MIN ) == UINT64_MAX );
+    EXPECT( zigzag_decode( UINT64_MAX ) == INT64_MIN );
+    EXPECT( zigzag_decode( zigzag_encode( -123456789 ) ) == -123456789 );
+}
+
+CASE( "varint: Allows to encode small values in a single byte" )
+{
+    unsigned char buf[ varint_max_bytes ];
+
+    EXPECT( encode_varint( Id( 127 ), buf ) == 1u );
+    EXPECT( encode_varint( Price( -64 ), buf ) == 1u );
+    EXPECT( encode_varint( Id( 128 ), buf ) == 2u );
+    EXPECT( encode_varint( Id( UINT64_MAX ), buf ) == 10u );
+}
+
+CASE( "varint: Allows to round-trip signed and unsigned strong values" )
+{
+    std::int32_t const prices[] = { 0, 1, -1, 300, -300, INT32_MAX, INT32_MIN, };
+    std::uint64_t const ids[]   = { 0, 1, 127, 128, 16384, UINT64_MAX, };
+
+    for ( std::int32_t p : prices )
+    {
+        unsigned char buf[ varint_max_bytes ];
+        std::size_t n = encode_varint( Price( p ), buf );
+
+        Price out;
+        EXPECT( decode_varint( buf, buf + n, out ) == buf + n );
+        EXPECT( to_value( out ) == p );
+    }
+
+    for ( std::uint64_t id : ids )
+    {
+        unsigned char buf[ varint_max_bytes ];
+        std::size_t n = encode_varint( Id( id ), buf );
+
+        Id out;
+        EXPECT( decode_varint( buf, buf + n, out ) == buf + n );
+        EXPECT( to_value( out ) == id );
+    }
+}
+
+CASE( "varint: Rejects truncated, overlong and out-of-range input" )
+{
+    unsigned char const truncated[] = { 0x80, 0x80, };
+    unsigned char const overlong [] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, };
+    unsigned char const too_big  [] = { 0x80, 0x02, };    // 256
+
+    Id   id;
+    Tiny tiny;
+
+    EXPECT( decode_varint( truncated, truncated + 2 , id ) == nullptr );
+    EXPECT( decode_varint( overlong , overlong  + 10, id ) == nullptr );
+    EXPECT( decode_varint( too_big  , too_big   + 2 , tiny ) == nullptr );
+}
+
+CASE( "varint: Allows to bulk-encode and -decode an array of strong values" )
+{
+    std::mt19937 gen( 42 );
+    std::vector<Price> v;
+
+    for ( int i = 0; i != 1000; ++i )
+        v.push_back( Price( i % 3 ? static_cast<std::int32_t>( gen() % 100 ) - 50 : static_cast<std::int32_t>( gen() ) ) );
+
+    varint_array<Price> enc( v.begin(), v.end() );
+    std::vector<Price> out( v.size() );
+
+    EXPECT( enc.size() == v.size() );
+    EXPECT( enc.size_bytes() < v.size() * sizeof( Price ) );
+    EXPECT( enc.decode( out.data() ) );
+
+    bool same = true;
+    for ( std::size_t i = 0; i != v.size(); ++i )
+        same = same && to_value( out[i] ) == to_value( v[i] );
+
+    EXPECT( same );
+}
+
+CASE( "varint: Rejects a malformed payload on bulk-decode" )
+{
+    unsigned char const bytes[] = { 1, 2, 0x80, };
+
+    varint_array<Id> enc( bytes, bytes + 3, 3 );
+    std::vector<Id> out( 3 );
+
+    EXPECT( !enc.decode( out.data() ) );
+}
+
+CASE( "varint: Disallows to decode a payload into another strong type (define type_CONFIG_CONFIRMS_COMPILATION_ERRORS)" )
+{
+#if type_CONFIG_CONFIRMS_COMPILATION_ERRORS
+    typedef numeric< std::int32_t, struct QuantityTag > Quantity;
+
+    varint_array<Price> enc;
+    Quantity out[1];
+    enc.decode( out );
+#endif
+    EXPECT( true );
+}
+
+} // anonymous namespace
+
+#endif // type_CPP11_OR_GREATER